@@ -0,0 +1,98 @@
+"""Measures the throughput of COPY FROM CSV in GB/s across file sizes.
+
+Each file is copied into a fresh database with the parallel and the serial CSV reader. Files are
+generated with and without quoted values that contain newlines, which the parallel reader
+handles by resolving the quote state at the boundaries of the blocks it reads.
+
+Usage:
+    python3 benchmark/copy_csv_benchmark.py --sizes 64 256 1024 --threads 8
+"""
+
+import argparse
+import os
+import random
+import shutil
+import string
+import tempfile
+import time
+
+import kuzu
+
+SCHEMA = "CREATE NODE TABLE T(id INT64, name STRING, score DOUBLE, comment STRING, " \
+         "PRIMARY KEY(id))"
+
+
+def generate_csv(path, size_mb, multiline):
+    rng = random.Random(0)
+    target_size = size_mb * 1024 * 1024
+    written = 0
+    row_id = 0
+    with open(path, "w", newline="") as f:
+        f.write("id,name,score,comment\n")
+        while written < target_size:
+            name = "".join(rng.choices(string.ascii_letters, k=rng.randint(5, 20)))
+            words = [''.join(rng.choices(string.ascii_lowercase, k=rng.randint(2, 8)))
+                     for _ in range(rng.randint(3, 12))]
+            if multiline and row_id % 4 == 0:
+                value = "\n".join(words) + ', "quoted"'
+                comment = '"' + value.replace('"', '""') + '"'
+            else:
+                comment = " ".join(words)
+            line = f"{row_id},{name},{rng.random() * 100:.4f},{comment}\n"
+            f.write(line)
+            written += len(line)
+            row_id += 1
+    return row_id
+
+
+def run_copy(csv_path, parallel, num_threads):
+    db_dir = tempfile.mkdtemp(prefix="kuzu_copy_bench_")
+    try:
+        db = kuzu.Database(os.path.join(db_dir, "db"))
+        conn = kuzu.Connection(db, num_threads=num_threads)
+        conn.execute(SCHEMA)
+        start = time.perf_counter()
+        conn.execute(f'COPY T FROM "{csv_path}" (HEADER=true, PARALLEL={str(parallel).upper()})')
+        elapsed = time.perf_counter() - start
+        num_rows = conn.execute("MATCH (t:T) RETURN count(*)").get_next()[0]
+        return elapsed, num_rows
+    finally:
+        shutil.rmtree(db_dir, ignore_errors=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--sizes", type=int, nargs="+", default=[16, 64, 256],
+                        help="CSV file sizes in MB")
+    parser.add_argument("--threads", type=int, default=os.cpu_count())
+    parser.add_argument("--runs", type=int, default=3)
+    parser.add_argument("--data-dir", default=None,
+                        help="directory to write the generated CSV files to")
+    args = parser.parse_args()
+
+    data_dir = args.data_dir or tempfile.mkdtemp(prefix="kuzu_copy_bench_data_")
+    os.makedirs(data_dir, exist_ok=True)
+    print(f"{'size (MB)':>10} {'newlines':>9} {'reader':>9} {'rows':>11} {'best (s)':>9} "
+          f"{'GB/s':>7}")
+    for size_mb in args.sizes:
+        for multiline in (False, True):
+            csv_path = os.path.join(data_dir, f"copy_{size_mb}mb_{int(multiline)}.csv")
+            expected_rows = generate_csv(csv_path, size_mb, multiline)
+            file_size = os.path.getsize(csv_path)
+            for parallel in (True, False):
+                best = None
+                for _ in range(args.runs):
+                    elapsed, num_rows = run_copy(csv_path, parallel, args.threads)
+                    assert num_rows == expected_rows, (num_rows, expected_rows)
+                    best = elapsed if best is None else min(best, elapsed)
+                reader = "parallel" if parallel else "serial"
+                print(f"{size_mb:>10} {str(multiline):>9} {reader:>9} {expected_rows:>11} "
+                      f"{best:>9.3f} {file_size / best / 1e9:>7.3f}")
+            os.remove(csv_path)
+    if args.data_dir is None:
+        shutil.rmtree(data_dir, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -3,6 +3,7 @@
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/constants.h"
 #include "common/exception/binder.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/string_utils.h"
@@ -107,6 +108,21 @@ bool Binder::bindExportTableData(ExportedTableData& tableData, const TableCatalo
     return true;
 }
 
+// With per thread output, the files of table T are imported from T_*.csv, which must not match the
+// files of another table.
+static void validatePerThreadOutput(const std::vector<ExportedTableData>& exportData) {
+    for (auto& tableData : exportData) {
+        for (auto& otherTableData : exportData) {
+            if (otherTableData.tableName.starts_with(tableData.tableName + "_")) {
+                throw BinderException{stringFormat(
+                    "Cannot export table {} with per thread output since its files would be "
+                    "imported into table {}.",
+                    otherTableData.tableName, tableData.tableName)};
+            }
+        }
+    }
+}
+
 std::unique_ptr<BoundStatement> Binder::bindExportDatabaseClause(const Statement& statement) {
     auto& exportDB = statement.constCast<ExportDB>();
     auto boundFilePath =
@@ -124,6 +140,12 @@ std::unique_ptr<BoundStatement> Binder::bindExportDatabaseClause(const Statement
     if (fileTypeInfo.fileType != FileType::CSV && parsedOptions.size() != 0) {
         throw BinderException{"Only export to csv can have options."};
     }
+    if (parsedOptions.contains(ExportCSVConstants::COMPRESSION_OPTION)) {
+        throw BinderException{"Export database does not support compressed csv files."};
+    }
+    if (parsedOptions.contains(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION)) {
+        validatePerThreadOutput(exportData);
+    }
     return std::make_unique<BoundExportDatabase>(boundFilePath, fileTypeInfo, std::move(exportData),
         std::move(parsedOptions));
 }
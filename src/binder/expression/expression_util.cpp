@@ -231,6 +231,12 @@ bool ExpressionUtil::getLiteralValue(const Expression& expr) {
     return expr.constCast<LiteralExpression>().getValue().getValue<bool>();
 }
 template<>
+double ExpressionUtil::getLiteralValue(const Expression& expr) {
+    validateExpressionType(expr, ExpressionType::LITERAL);
+    validateDataType(expr, LogicalType::DOUBLE());
+    return expr.constCast<LiteralExpression>().getValue().getValue<double>();
+}
+template<>
 std::string ExpressionUtil::getLiteralValue(const Expression& expr) {
     validateExpressionType(expr, ExpressionType::LITERAL);
     validateDataType(expr, LogicalType::STRING());
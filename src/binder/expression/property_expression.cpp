@@ -49,5 +49,15 @@ bool PropertyExpression::hasProperty(common::table_id_t tableID) const {
     return infos.at(tableID).exists;
 }
 
+std::vector<table_id_t> PropertyExpression::getTableIDs() const {
+    std::vector<table_id_t> result;
+    for (auto& [tableID, info] : infos) {
+        if (info.exists) {
+            result.push_back(tableID);
+        }
+    }
+    return result;
+}
+
 } // namespace binder
 } // namespace kuzu
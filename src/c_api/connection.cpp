@@ -155,3 +155,15 @@ kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection, uint64
     }
     return KuzuSuccess;
 }
+
+kuzu_state kuzu_connection_set_stream_results(kuzu_connection* connection, bool stream_results) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return KuzuError;
+    }
+    try {
+        static_cast<Connection*>(connection->_connection)->setStreamResults(stream_results);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
@@ -57,7 +57,12 @@ kuzu_state kuzu_query_result_get_column_data_type(kuzu_query_result* query_resul
 }
 
 uint64_t kuzu_query_result_get_num_tuples(kuzu_query_result* query_result) {
-    return static_cast<QueryResult*>(query_result->_query_result)->getNumTuples();
+    // Counting the tuples of a streamed result reads the rest of the stream, which may fail.
+    try {
+        return static_cast<QueryResult*>(query_result->_query_result)->getNumTuples();
+    } catch (std::exception& e) {
+        return 0;
+    }
 }
 
 kuzu_state kuzu_query_result_get_query_summary(kuzu_query_result* query_result,
@@ -71,7 +76,13 @@ kuzu_state kuzu_query_result_get_query_summary(kuzu_query_result* query_result,
 }
 
 bool kuzu_query_result_has_next(kuzu_query_result* query_result) {
-    return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    // Errors of streamed results surface while iterating and are reported by
+    // kuzu_query_result_is_success afterwards.
+    try {
+        return static_cast<QueryResult*>(query_result->_query_result)->hasNext();
+    } catch (std::exception& e) {
+        return false;
+    }
 }
 
 bool kuzu_query_result_has_next_query_result(kuzu_query_result* query_result) {
@@ -100,18 +111,28 @@ kuzu_state kuzu_query_result_get_next(kuzu_query_result* query_result,
         out_flat_tuple->_flat_tuple = flat_tuple.get();
         out_flat_tuple->_is_owned_by_cpp = true;
         return KuzuSuccess;
-    } catch (Exception& e) {
+    } catch (std::exception& e) {
         return KuzuError;
     }
 }
 
 char* kuzu_query_result_to_string(kuzu_query_result* query_result) {
-    std::string result_string = static_cast<QueryResult*>(query_result->_query_result)->toString();
+    std::string result_string;
+    try {
+        result_string = static_cast<QueryResult*>(query_result->_query_result)->toString();
+    } catch (std::exception& e) {
+        result_string = e.what();
+    }
     return convertToOwnedCString(result_string);
 }
 
 void kuzu_query_result_reset_iterator(kuzu_query_result* query_result) {
-    static_cast<QueryResult*>(query_result->_query_result)->resetIterator();
+    try {
+        static_cast<QueryResult*>(query_result->_query_result)->resetIterator();
+    } catch (std::exception& e) {
+        // A partially consumed streamed result cannot be reset, and its iterator is left as is.
+        // Errors raised while reading the stream are reported by kuzu_query_result_is_success.
+    }
 }
 
 kuzu_state kuzu_query_result_get_arrow_schema(kuzu_query_result* query_result,
@@ -130,7 +151,7 @@ kuzu_state kuzu_query_result_get_next_arrow_chunk(kuzu_query_result* query_resul
         *out_arrow_array =
             *static_cast<QueryResult*>(query_result->_query_result)->getNextArrowChunk(chunk_size);
         return KuzuSuccess;
-    } catch (Exception& e) {
+    } catch (std::exception& e) {
         return KuzuError;
     }
 }
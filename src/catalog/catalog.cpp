@@ -214,6 +214,7 @@ table_id_t Catalog::createTableSchema(Transaction* transaction, const BoundCreat
             createSequence(transaction, seqInfo);
         }
     }
+    incrementVersion();
     return tables->createEntry(transaction, std::move(entry));
 }
 
@@ -249,6 +250,7 @@ void Catalog::dropTableEntry(Transaction* transaction, table_id_t tableID) {
         }
     }
     tables->dropEntry(transaction, tableEntry->getName(), tableEntry->getOID());
+    incrementVersion();
 }
 
 void Catalog::alterTableEntry(Transaction* transaction, const BoundAlterInfo& info) {
@@ -259,6 +261,7 @@ void Catalog::alterTableEntry(Transaction* transaction, const BoundAlterInfo& in
         alterRdfChildTableEntries(transaction, tableEntry, info);
     }
     tables->alterEntry(transaction, info);
+    incrementVersion();
 }
 
 bool Catalog::containsSequence(const Transaction* transaction,
@@ -294,6 +297,7 @@ sequence_id_t Catalog::createSequence(Transaction* transaction,
     const BoundCreateSequenceInfo& info) {
     auto entry = std::make_unique<SequenceCatalogEntry>(info);
     entry->setHasParent(info.hasParent);
+    incrementVersion();
     return sequences->createEntry(transaction, std::move(entry));
 }
 
@@ -305,6 +309,7 @@ void Catalog::dropSequence(Transaction* transaction, const std::string& name) {
 void Catalog::dropSequence(Transaction* transaction, sequence_id_t sequenceID) {
     const auto sequenceEntry = getSequenceCatalogEntry(transaction, sequenceID);
     sequences->dropEntry(transaction, sequenceEntry->getName(), sequenceEntry->getOID());
+    incrementVersion();
 }
 
 std::string Catalog::genSerialName(const std::string& tableName, const std::string& propertyName) {
@@ -315,6 +320,7 @@ void Catalog::createType(Transaction* transaction, std::string name, LogicalType
     KU_ASSERT(!types->containsEntry(transaction, name));
     auto entry = std::make_unique<TypeCatalogEntry>(std::move(name), std::move(type));
     types->createEntry(transaction, std::move(entry));
+    incrementVersion();
 }
 
 LogicalType Catalog::getType(const Transaction* transaction, const std::string& name) const {
@@ -339,6 +345,7 @@ void Catalog::addFunction(Transaction* transaction, CatalogEntryType entryType,
     }
     functions->createEntry(transaction,
         std::make_unique<FunctionCatalogEntry>(entryType, std::move(name), std::move(functionSet)));
+    incrementVersion();
 }
 
 void Catalog::dropFunction(Transaction* transaction, const std::string& name) {
@@ -347,6 +354,7 @@ void Catalog::dropFunction(Transaction* transaction, const std::string& name) {
         throw CatalogException{stringFormat("function {} doesn't exist.", name)};
     }
     functions->dropEntry(transaction, std::move(name), entry->getOID());
+    incrementVersion();
 }
 
 void Catalog::addBuiltInFunction(CatalogEntryType entryType, std::string name,
@@ -392,6 +400,7 @@ void Catalog::addScalarMacroFunction(Transaction* transaction, std::string name,
     auto scalarMacroCatalogEntry =
         std::make_unique<ScalarMacroCatalogEntry>(std::move(name), std::move(macro));
     functions->createEntry(transaction, std::move(scalarMacroCatalogEntry));
+    incrementVersion();
 }
 
 std::vector<std::string> Catalog::getMacroNames(const Transaction* transaction) const {
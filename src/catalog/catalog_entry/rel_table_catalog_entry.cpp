@@ -5,6 +5,7 @@
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog.h"
 #include "common/serializer/deserializer.h"
+#include "function/table/call_functions.h"
 #include "main/client_context.h"
 
 using namespace kuzu::binder;
@@ -43,6 +44,8 @@ void RelTableCatalogEntry::serialize(Serializer& serializer) const {
     serializer.write(srcTableID);
     serializer.writeDebuggingInfo("dstTableID");
     serializer.write(dstTableID);
+    serializer.writeDebuggingInfo("sortedAdjacencyLists");
+    serializer.write(sortedAdjacencyLists);
 }
 
 std::unique_ptr<RelTableCatalogEntry> RelTableCatalogEntry::deserialize(
@@ -52,6 +55,7 @@ std::unique_ptr<RelTableCatalogEntry> RelTableCatalogEntry::deserialize(
     RelMultiplicity dstMultiplicity{};
     table_id_t srcTableID = INVALID_TABLE_ID;
     table_id_t dstTableID = INVALID_TABLE_ID;
+    bool sortedAdjacencyLists = false;
     deserializer.validateDebuggingInfo(debuggingInfo, "srcMultiplicity");
     deserializer.deserializeValue(srcMultiplicity);
     deserializer.validateDebuggingInfo(debuggingInfo, "dstMultiplicity");
@@ -60,11 +64,14 @@ std::unique_ptr<RelTableCatalogEntry> RelTableCatalogEntry::deserialize(
     deserializer.deserializeValue(srcTableID);
     deserializer.validateDebuggingInfo(debuggingInfo, "dstTableID");
     deserializer.deserializeValue(dstTableID);
+    deserializer.validateDebuggingInfo(debuggingInfo, "sortedAdjacencyLists");
+    deserializer.deserializeValue(sortedAdjacencyLists);
     auto relTableEntry = std::make_unique<RelTableCatalogEntry>();
     relTableEntry->srcMultiplicity = srcMultiplicity;
     relTableEntry->dstMultiplicity = dstMultiplicity;
     relTableEntry->srcTableID = srcTableID;
     relTableEntry->dstTableID = dstTableID;
+    relTableEntry->sortedAdjacencyLists = sortedAdjacencyLists;
     return relTableEntry;
 }
 
@@ -74,6 +81,7 @@ std::unique_ptr<TableCatalogEntry> RelTableCatalogEntry::copy() const {
     other->dstMultiplicity = dstMultiplicity;
     other->srcTableID = srcTableID;
     other->dstTableID = dstTableID;
+    other->sortedAdjacencyLists = sortedAdjacencyLists;
     other->copyFrom(*this);
     return other;
 }
@@ -88,6 +96,11 @@ std::string RelTableCatalogEntry::toCypher(main::ClientContext* clientContext) c
     std::string tableInfo =
         stringFormat("CREATE REL TABLE {} (FROM {} TO {}, ", getName(), srcTableName, dstTableName);
     ss << tableInfo << propertyCollection.toCypher() << srcMultiStr << "_" << dstMultiStr << ");";
+    if (sortedAdjacencyLists) {
+        ss << std::endl
+           << stringFormat("CALL {}('{}') RETURN *;", function::SortAdjacencyListsFunction::name,
+                  getName());
+    }
     return ss.str();
 }
 
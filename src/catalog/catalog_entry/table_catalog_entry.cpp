@@ -24,6 +24,11 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::alter(const BoundAlterInfo
     case AlterType::RENAME_PROPERTY: {
         auto& renamePropInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraRenamePropertyInfo>();
         newEntry->renameProperty(renamePropInfo.oldName, renamePropInfo.newName);
+        if (auto oldStatistics = newEntry->getStatistics()) {
+            auto newStatistics = std::make_shared<TableStatistics>(oldStatistics->copy());
+            newStatistics->renameProperty(renamePropInfo.oldName, renamePropInfo.newName);
+            newEntry->setStatistics(std::move(newStatistics));
+        }
     } break;
     case AlterType::ADD_PROPERTY: {
         auto& addPropInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraAddPropertyInfo>();
@@ -32,6 +37,11 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::alter(const BoundAlterInfo
     case AlterType::DROP_PROPERTY: {
         auto& dropPropInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraDropPropertyInfo>();
         newEntry->dropProperty(dropPropInfo.propertyName);
+        if (auto oldStatistics = newEntry->getStatistics()) {
+            auto newStatistics = std::make_shared<TableStatistics>(oldStatistics->copy());
+            newStatistics->dropProperty(dropPropInfo.propertyName);
+            newEntry->setStatistics(std::move(newStatistics));
+        }
     } break;
     case AlterType::COMMENT: {
         auto& commentInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraCommentInfo>();
@@ -44,6 +54,16 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::alter(const BoundAlterInfo
     return newEntry;
 }
 
+std::shared_ptr<const TableStatistics> TableCatalogEntry::getStatistics() const {
+    std::unique_lock lck{statisticsMtx};
+    return statistics;
+}
+
+void TableCatalogEntry::setStatistics(std::shared_ptr<const TableStatistics> newStatistics) {
+    std::unique_lock lck{statisticsMtx};
+    statistics = std::move(newStatistics);
+}
+
 column_id_t TableCatalogEntry::getMaxColumnID() const {
     return propertyCollection.getMaxColumnID();
 }
@@ -95,6 +115,12 @@ void TableCatalogEntry::serialize(Serializer& serializer) const {
     serializer.write(comment);
     serializer.writeDebuggingInfo("properties");
     propertyCollection.serialize(serializer);
+    serializer.writeDebuggingInfo("statistics");
+    auto currentStatistics = getStatistics();
+    serializer.write(currentStatistics != nullptr);
+    if (currentStatistics) {
+        currentStatistics->serialize(serializer);
+    }
 }
 
 std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer& deserializer,
@@ -105,6 +131,13 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer&
     deserializer.deserializeValue(comment);
     deserializer.validateDebuggingInfo(debuggingInfo, "properties");
     auto propertyCollection = PropertyDefinitionCollection::deserialize(deserializer);
+    deserializer.validateDebuggingInfo(debuggingInfo, "statistics");
+    bool hasStatistics = false;
+    deserializer.deserializeValue(hasStatistics);
+    std::shared_ptr<const TableStatistics> statistics;
+    if (hasStatistics) {
+        statistics = TableStatistics::deserialize(deserializer);
+    }
     std::unique_ptr<TableCatalogEntry> result;
     switch (type) {
     case CatalogEntryType::NODE_TABLE_ENTRY:
@@ -124,6 +157,7 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer&
     }
     result->comment = std::move(comment);
     result->propertyCollection = std::move(propertyCollection);
+    result->statistics = std::move(statistics);
     return result;
 }
 
@@ -133,6 +167,8 @@ void TableCatalogEntry::copyFrom(const CatalogEntry& other) {
     set = otherTable.set;
     comment = otherTable.comment;
     propertyCollection = otherTable.propertyCollection.copy();
+    // Statistics are immutable once set, so versions of an entry can share them.
+    statistics = otherTable.getStatistics();
 }
 
 BoundCreateTableInfo TableCatalogEntry::getBoundCreateTableInfo(
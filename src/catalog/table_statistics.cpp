@@ -0,0 +1,107 @@
+#include "catalog/table_statistics.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace catalog {
+
+bool PropertyStatistics::supportsHistogram(LogicalTypeID typeID) {
+    switch (typeID) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+double PropertyStatistics::getEqualitySelectivity() const {
+    KU_ASSERT(numDistinct > 0);
+    return (1 - nullFraction) / numDistinct;
+}
+
+double PropertyStatistics::getLessThanSelectivity(double value, bool inclusive) const {
+    KU_ASSERT(hasHistogram());
+    const auto numBounds = histogramBounds.size();
+    // Number of bounds that are less than (or equal to) the value.
+    const auto numBoundsBelow =
+        (inclusive ? std::upper_bound(histogramBounds.begin(), histogramBounds.end(), value) :
+                     std::lower_bound(histogramBounds.begin(), histogramBounds.end(), value)) -
+        histogramBounds.begin();
+    double fractionOfValues = 0;
+    if (numBoundsBelow == (int64_t)numBounds) {
+        fractionOfValues = 1;
+    } else if (numBoundsBelow > 0) {
+        // Interpolate linearly within the bucket containing the value.
+        const auto bucketIdx = numBoundsBelow - 1;
+        const auto lower = histogramBounds[bucketIdx];
+        const auto upper = histogramBounds[bucketIdx + 1];
+        const auto fractionOfBucket = upper > lower ? (value - lower) / (upper - lower) : 0;
+        fractionOfValues = (bucketIdx + fractionOfBucket) / (double)(numBounds - 1);
+    }
+    return fractionOfValues * (1 - nullFraction);
+}
+
+void PropertyStatistics::serialize(Serializer& serializer) const {
+    serializer.write(nullFraction);
+    serializer.write(numDistinct);
+    serializer.serializeVector(histogramBounds);
+}
+
+PropertyStatistics PropertyStatistics::deserialize(Deserializer& deserializer) {
+    PropertyStatistics result;
+    deserializer.deserializeValue(result.nullFraction);
+    deserializer.deserializeValue(result.numDistinct);
+    deserializer.deserializeVector(result.histogramBounds);
+    return result;
+}
+
+void TableStatistics::renameProperty(const std::string& propertyName,
+    const std::string& newName) {
+    if (!propertyStatistics.contains(propertyName)) {
+        return;
+    }
+    auto statistics = std::move(propertyStatistics.at(propertyName));
+    propertyStatistics.erase(propertyName);
+    propertyStatistics.insert_or_assign(newName, std::move(statistics));
+}
+
+void TableStatistics::serialize(Serializer& serializer) const {
+    serializer.write(numRows);
+    serializer.write<uint64_t>(propertyStatistics.size());
+    for (auto& [propertyName, statistics] : propertyStatistics) {
+        serializer.write(propertyName);
+        statistics.serialize(serializer);
+    }
+}
+
+std::unique_ptr<TableStatistics> TableStatistics::deserialize(Deserializer& deserializer) {
+    uint64_t numRows = 0;
+    uint64_t numProperties = 0;
+    deserializer.deserializeValue(numRows);
+    deserializer.deserializeValue(numProperties);
+    auto result = std::make_unique<TableStatistics>(numRows);
+    for (auto i = 0u; i < numProperties; i++) {
+        std::string propertyName;
+        deserializer.deserializeValue(propertyName);
+        result->setPropertyStatistics(propertyName, PropertyStatistics::deserialize(deserializer));
+    }
+    return result;
+}
+
+} // namespace catalog
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #include "common/arrow/arrow_converter.h"
 
+#include <cerrno>
 #include <cstring>
 
 #include "common/arrow/arrow_row_batch.h"
@@ -278,5 +279,62 @@ void ArrowConverter::toArrowArray(main::QueryResult& queryResult, ArrowArray* ou
     *outArray = rowBatch->append(queryResult, chunkSize);
 }
 
+struct ArrowArrayStreamHolder {
+    main::QueryResult* queryResult;
+    std::int64_t chunkSize;
+    std::string lastError;
+};
+
+static int getArrowArrayStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    try {
+        auto schema = holder->queryResult->getArrowSchema();
+        // The release callback and private data of the schema move to out.
+        *out = *schema;
+    } catch (std::exception& e) {
+        holder->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static int getArrowArrayStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    try {
+        if (!holder->queryResult->hasNext()) {
+            // A released array marks the end of the stream.
+            out->release = nullptr;
+            return 0;
+        }
+        ArrowConverter::toArrowArray(*holder->queryResult, out, holder->chunkSize);
+    } catch (std::exception& e) {
+        holder->lastError = e.what();
+        return EIO;
+    }
+    return 0;
+}
+
+static const char* getArrowArrayStreamLastError(ArrowArrayStream* stream) {
+    auto holder = static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+    return holder->lastError.empty() ? nullptr : holder->lastError.c_str();
+}
+
+static void releaseArrowArrayStream(ArrowArrayStream* stream) {
+    if (!stream || !stream->release) {
+        return;
+    }
+    stream->release = nullptr;
+    delete static_cast<ArrowArrayStreamHolder*>(stream->private_data);
+}
+
+void ArrowConverter::toArrowArrayStream(main::QueryResult& queryResult,
+    ArrowArrayStream* outStream, std::int64_t chunkSize) {
+    outStream->get_schema = getArrowArrayStreamSchema;
+    outStream->get_next = getArrowArrayStreamNext;
+    outStream->get_last_error = getArrowArrayStreamLastError;
+    outStream->release = releaseArrowArrayStream;
+    outStream->private_data = new ArrowArrayStreamHolder{&queryResult, chunkSize, ""};
+}
+
 } // namespace common
 } // namespace kuzu
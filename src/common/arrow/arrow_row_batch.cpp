@@ -1,5 +1,7 @@
 #include "common/arrow/arrow_row_batch.h"
 
+#include <algorithm>
+#include <bit>
 #include <cstring>
 
 #include "common/exception/runtime.h"
@@ -7,6 +9,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -951,7 +954,177 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+bool ArrowRowBatch::canAppendVector(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::INTERVAL:
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING:
+        return true;
+    default:
+        // Nested types are still appended value by value. Decimals are widened to 16 bytes in
+        // arrow regardless of their physical type.
+        return false;
+    }
+}
+
+bool ArrowRowBatch::canAppendVectors(const main::QueryResult& queryResult) const {
+    if (queryResult.hasUnflatColumns()) {
+        return false;
+    }
+    return std::all_of(types.begin(), types.end(),
+        [](const LogicalType& type) { return canAppendVector(type); });
+}
+
+static std::int64_t countNulls(const uint64_t* nullEntries, std::int64_t numValues) {
+    std::int64_t numNulls = 0;
+    auto numFullEntries = numValues >> NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2;
+    for (auto i = 0; i < numFullEntries; i++) {
+        numNulls += std::popcount(nullEntries[i]);
+    }
+    auto numRemainingBits = numValues - (numFullEntries << NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2);
+    if (numRemainingBits > 0) {
+        numNulls +=
+            std::popcount(nullEntries[numFullEntries] & (((uint64_t)1 << numRemainingBits) - 1));
+    }
+    return numNulls;
+}
+
+void ArrowRowBatch::appendValidity(ArrowVector* vector, const ValueVector& valueVector,
+    std::int64_t numValues) {
+    // Validity bits are initialized to one, so only vectors with nulls need to be copied.
+    if (valueVector.hasNoNullsGuarantee()) {
+        return;
+    }
+    const auto* nullEntries = valueVector.getNullMask().getData();
+    auto numNulls = countNulls(nullEntries, numValues);
+    if (numNulls == 0) {
+        return;
+    }
+    // Both bitmaps are LSB-first, so the arrow bitmap is the inverted null mask. The copy writes
+    // whole 64-bit entries.
+    auto endPos = vector->numValues + numValues;
+    vector->validity.reserve(
+        NullMask::getNumNullEntries(endPos) * NullMask::NUM_BYTES_PER_NULL_ENTRY);
+    NullMask::copyNullMask(nullEntries, 0 /* srcOffset */, (uint64_t*)vector->validity.data(),
+        vector->numValues, numValues, true /* invert */);
+    vector->numNulls += numNulls;
+}
+
+void ArrowRowBatch::appendStringVector(ArrowVector* vector, const ValueVector& valueVector,
+    std::int64_t numValues) {
+    auto offsets = (std::uint32_t*)vector->data.data();
+    auto strings = (const ku_string_t*)valueVector.getData();
+    auto pos = vector->numValues;
+    if (pos == 0) {
+        offsets[0] = 0;
+    }
+    auto hasNulls = !valueVector.hasNoNullsGuarantee();
+    for (auto i = 0; i < numValues; i++) {
+        auto isNull = hasNulls && valueVector.isNull(i);
+        offsets[pos + i + 1] = offsets[pos + i] + (isNull ? 0 : strings[i].len);
+    }
+    vector->overflow.resize(offsets[pos + numValues] + 1);
+    for (auto i = 0; i < numValues; i++) {
+        if (hasNulls && valueVector.isNull(i)) {
+            continue;
+        }
+        std::memcpy(vector->overflow.data() + offsets[pos + i], strings[i].getData(),
+            strings[i].len);
+    }
+}
+
+void ArrowRowBatch::appendVector(ArrowVector* vector, const LogicalType& type,
+    const ValueVector& valueVector, std::int64_t numValues) {
+    // Vectors scanned from a factorized table are unfiltered, so values start at position 0.
+    KU_ASSERT(valueVector.state->getSelVector().isUnfiltered());
+    appendValidity(vector, valueVector, numValues);
+    auto pos = vector->numValues;
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        auto values = (const bool*)valueVector.getData();
+        for (auto i = 0; i < numValues; i++) {
+            if (values[i]) {
+                setBitToOne(vector->data.data(), pos + i);
+            } else {
+                setBitToZero(vector->data.data(), pos + i);
+            }
+        }
+    } break;
+    case LogicalTypeID::INTERVAL: {
+        auto values = (const interval_t*)valueVector.getData();
+        auto dst = (int64_t*)vector->data.data() + pos;
+        for (auto i = 0; i < numValues; i++) {
+            dst[i] = values[i].micros + values[i].days * Interval::MICROS_PER_DAY +
+                     values[i].months * Interval::MICROS_PER_MONTH;
+        }
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        appendStringVector(vector, valueVector, numValues);
+    } break;
+    default: {
+        // Fixed-width values share their layout with arrow.
+        auto numBytesPerValue = valueVector.getNumBytesPerValue();
+        KU_ASSERT(getArrowMainBufferSize(type, 1) == numBytesPerValue);
+        std::memcpy(vector->data.data() + pos * numBytesPerValue, valueVector.getData(),
+            numValues * numBytesPerValue);
+    }
+    }
+    vector->numValues += numValues;
+}
+
+std::int64_t ArrowRowBatch::appendVectors(main::QueryResult& queryResult,
+    std::int64_t chunkSize) {
+    auto state = std::make_shared<DataChunkState>();
+    std::vector<std::unique_ptr<ValueVector>> valueVectors;
+    std::vector<ValueVector*> valueVectorPtrs;
+    for (auto& type : types) {
+        auto valueVector = std::make_unique<ValueVector>(type.copy(),
+            queryResult.getMemoryManager());
+        valueVector->setState(state);
+        valueVectorPtrs.push_back(valueVector.get());
+        valueVectors.push_back(std::move(valueVector));
+    }
+    std::int64_t numTuplesInBatch = 0;
+    while (numTuplesInBatch < chunkSize) {
+        auto numTuplesToScan =
+            std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, chunkSize - numTuplesInBatch);
+        auto numTuplesScanned = queryResult.scanNextFlatTuples(valueVectorPtrs, numTuplesToScan);
+        if (numTuplesScanned == 0) {
+            break;
+        }
+        for (auto i = 0u; i < types.size(); i++) {
+            appendVector(vectors[i].get(), types[i], *valueVectors[i], numTuplesScanned);
+        }
+        numTuplesInBatch += numTuplesScanned;
+    }
+    return numTuplesInBatch;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
+    if (canAppendVectors(queryResult)) {
+        numTuples += appendVectors(queryResult, chunkSize);
+        return toArray();
+    }
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
     while (numTuplesInBatch < chunkSize) {
@@ -0,0 +1,34 @@
+#include "common/bloom_filter.h"
+
+#include <algorithm>
+
+#include "common/exception/buffer_manager.h"
+#include "common/utils.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace common {
+
+BloomFilter::BloomFilter() = default;
+
+BloomFilter::~BloomFilter() = default;
+
+void BloomFilter::reset(storage::MemoryManager& memoryManager, uint64_t numKeys) {
+    buffer.reset();
+    words = nullptr;
+    wordIdxMask = 0;
+    const auto numWords = std::min(MAX_NUM_WORDS,
+        nextPowerOfTwo(std::max<uint64_t>(1, numKeys * NUM_BITS_PER_KEY / 64)));
+    try {
+        buffer = memoryManager.allocateBuffer(true /* initializeToZero */,
+            numWords * sizeof(uint64_t));
+    } catch (BufferManagerException&) {
+        // The filter is only an optimization, so the join runs without it.
+        return;
+    }
+    words = reinterpret_cast<uint64_t*>(buffer->getData());
+    wordIdxMask = numWords - 1;
+}
+
+} // namespace common
+} // namespace kuzu
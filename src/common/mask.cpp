@@ -0,0 +1,45 @@
+#include "common/mask.h"
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace common {
+
+void NodeSemiMask::incrementNumMasks() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numMasks < UINT8_MAX);
+    numMasks++;
+    masks.resize(numMasks);
+    isMaskToReadValid.store(false, std::memory_order_release);
+}
+
+void NodeSemiMask::mergeMask(uint8_t maskIdx, const RoaringBitmap& offsets) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(maskIdx < numMasks);
+    masks[maskIdx].unionWith(offsets);
+    isMaskToReadValid.store(false, std::memory_order_release);
+}
+
+const RoaringBitmap& NodeSemiMask::getMaskToRead() {
+    if (!isMaskToReadValid.load(std::memory_order_acquire)) {
+        std::unique_lock lck{mtx};
+        if (!isMaskToReadValid.load(std::memory_order_relaxed)) {
+            KU_ASSERT(numMasks > 0);
+            if (numMasks == 1) {
+                maskToRead = &masks[0];
+            } else {
+                intersectedMask = RoaringBitmap{};
+                intersectedMask.unionWith(masks[0]);
+                for (auto i = 1u; i < numMasks; i++) {
+                    intersectedMask.intersectWith(masks[i]);
+                }
+                maskToRead = &intersectedMask;
+            }
+            isMaskToReadValid.store(true, std::memory_order_release);
+        }
+    }
+    return *maskToRead;
+}
+
+} // namespace common
+} // namespace kuzu
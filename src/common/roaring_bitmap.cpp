@@ -0,0 +1,263 @@
+#include "common/roaring_bitmap.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace common {
+
+static uint64_t getWordMask(uint32_t startBit, uint32_t endBit) {
+    // Bits [startBit, endBit] of a word, with endBit < 64.
+    const auto highMask = endBit == 63 ? ~(uint64_t)0 : ((uint64_t)1 << (endBit + 1)) - 1;
+    return highMask & (~(uint64_t)0 << startBit);
+}
+
+void RoaringContainer::add(uint16_t value) {
+    if (isDense()) {
+        auto& word = words[value >> 6];
+        const auto bit = (uint64_t)1 << (value & 63);
+        cardinality += (word & bit) == 0;
+        word |= bit;
+        return;
+    }
+    const auto it = std::lower_bound(values.begin(), values.end(), value);
+    if (it != values.end() && *it == value) {
+        return;
+    }
+    values.insert(it, value);
+    cardinality++;
+    if (cardinality > MAX_SPARSE_SIZE) {
+        toDense();
+    }
+}
+
+bool RoaringContainer::contains(uint16_t value) const {
+    if (isDense()) {
+        return words[value >> 6] & ((uint64_t)1 << (value & 63));
+    }
+    return std::binary_search(values.begin(), values.end(), value);
+}
+
+bool RoaringContainer::containsAny(uint16_t start, uint16_t end) const {
+    KU_ASSERT(start <= end);
+    if (isDense()) {
+        const auto startWord = start >> 6, endWord = end >> 6;
+        for (auto i = startWord; i <= endWord; i++) {
+            const auto startBit = i == startWord ? start & 63 : 0;
+            const auto endBit = i == endWord ? end & 63 : 63;
+            if (words[i] & getWordMask(startBit, endBit)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    const auto it = std::lower_bound(values.begin(), values.end(), start);
+    return it != values.end() && *it <= end;
+}
+
+int32_t RoaringContainer::getNextSetValue(uint32_t value) const {
+    if (value >= NUM_VALUES) {
+        return NO_VALUE;
+    }
+    if (isDense()) {
+        auto wordIdx = value >> 6;
+        auto word = words[wordIdx] & (~(uint64_t)0 << (value & 63));
+        while (word == 0) {
+            if (++wordIdx == NUM_WORDS) {
+                return NO_VALUE;
+            }
+            word = words[wordIdx];
+        }
+        return (int32_t)(wordIdx << 6) + std::countr_zero(word);
+    }
+    const auto it = std::lower_bound(values.begin(), values.end(), value);
+    return it == values.end() ? NO_VALUE : *it;
+}
+
+void RoaringContainer::unionWith(const RoaringContainer& other) {
+    if (!isDense() && !other.isDense()) {
+        std::vector<uint16_t> result;
+        result.reserve(values.size() + other.values.size());
+        std::set_union(values.begin(), values.end(), other.values.begin(), other.values.end(),
+            std::back_inserter(result));
+        values = std::move(result);
+        cardinality = values.size();
+        if (cardinality > MAX_SPARSE_SIZE) {
+            toDense();
+        }
+        return;
+    }
+    if (!other.isDense()) {
+        for (auto value : other.values) {
+            add(value);
+        }
+        return;
+    }
+    toDense();
+    cardinality = 0;
+    for (auto i = 0u; i < NUM_WORDS; i++) {
+        words[i] |= other.words[i];
+        cardinality += std::popcount(words[i]);
+    }
+}
+
+void RoaringContainer::intersectWith(const RoaringContainer& other) {
+    if (isDense() && other.isDense()) {
+        cardinality = 0;
+        for (auto i = 0u; i < NUM_WORDS; i++) {
+            words[i] &= other.words[i];
+            cardinality += std::popcount(words[i]);
+        }
+        if (cardinality <= MAX_SPARSE_SIZE) {
+            toSparse();
+        }
+        return;
+    }
+    std::vector<uint16_t> result;
+    if (isDense()) {
+        // The result is at most as large as the sparse side.
+        for (auto value : other.values) {
+            if (contains(value)) {
+                result.push_back(value);
+            }
+        }
+        words.clear();
+    } else if (other.isDense()) {
+        for (auto value : values) {
+            if (other.contains(value)) {
+                result.push_back(value);
+            }
+        }
+    } else {
+        std::set_intersection(values.begin(), values.end(), other.values.begin(),
+            other.values.end(), std::back_inserter(result));
+    }
+    values = std::move(result);
+    cardinality = values.size();
+}
+
+void RoaringContainer::toDense() {
+    if (isDense()) {
+        return;
+    }
+    words.assign(NUM_WORDS, 0);
+    for (auto value : values) {
+        words[value >> 6] |= (uint64_t)1 << (value & 63);
+    }
+    values.clear();
+    values.shrink_to_fit();
+}
+
+void RoaringContainer::toSparse() {
+    KU_ASSERT(isDense());
+    values.clear();
+    values.reserve(cardinality);
+    for (auto i = 0u; i < NUM_WORDS; i++) {
+        auto word = words[i];
+        while (word != 0) {
+            values.push_back((uint16_t)((i << 6) + std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+    words.clear();
+    words.shrink_to_fit();
+}
+
+void RoaringBitmap::add(offset_t offset) {
+    const auto chunkIdx = getChunkIdx(offset);
+    if (chunkIdx >= containers.size()) {
+        containers.resize(chunkIdx + 1);
+    }
+    if (containers[chunkIdx] == nullptr) {
+        containers[chunkIdx] = std::make_unique<RoaringContainer>();
+    }
+    containers[chunkIdx]->add(getValueInChunk(offset));
+}
+
+bool RoaringBitmap::contains(offset_t offset) const {
+    const auto chunkIdx = getChunkIdx(offset);
+    return chunkIdx < containers.size() && containers[chunkIdx] != nullptr &&
+           containers[chunkIdx]->contains(getValueInChunk(offset));
+}
+
+bool RoaringBitmap::containsAny(offset_t startOffset, offset_t endOffset) const {
+    KU_ASSERT(startOffset <= endOffset);
+    const auto startChunkIdx = getChunkIdx(startOffset);
+    const auto endChunkIdx = getChunkIdx(endOffset);
+    for (auto i = startChunkIdx; i <= endChunkIdx && i < containers.size(); i++) {
+        if (containers[i] == nullptr) {
+            continue;
+        }
+        const uint16_t start = i == startChunkIdx ? getValueInChunk(startOffset) : 0;
+        const uint16_t end =
+            i == endChunkIdx ? getValueInChunk(endOffset) : RoaringContainer::NUM_VALUES - 1;
+        if (containers[i]->containsAny(start, end)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+offset_t RoaringBitmap::getNextSetOffset(offset_t offset) const {
+    for (auto i = getChunkIdx(offset); i < containers.size(); i++) {
+        if (containers[i] == nullptr) {
+            continue;
+        }
+        const auto value =
+            containers[i]->getNextSetValue(i == getChunkIdx(offset) ? getValueInChunk(offset) : 0);
+        if (value != RoaringContainer::NO_VALUE) {
+            return (i << CHUNK_SIZE_LOG2) + value;
+        }
+    }
+    return INVALID_OFFSET;
+}
+
+void RoaringBitmap::unionWith(const RoaringBitmap& other) {
+    if (other.containers.size() > containers.size()) {
+        containers.resize(other.containers.size());
+    }
+    for (auto i = 0u; i < other.containers.size(); i++) {
+        if (other.containers[i] == nullptr) {
+            continue;
+        }
+        if (containers[i] == nullptr) {
+            containers[i] = std::make_unique<RoaringContainer>(*other.containers[i]);
+        } else {
+            containers[i]->unionWith(*other.containers[i]);
+        }
+    }
+}
+
+void RoaringBitmap::intersectWith(const RoaringBitmap& other) {
+    if (containers.size() > other.containers.size()) {
+        containers.resize(other.containers.size());
+    }
+    for (auto i = 0u; i < containers.size(); i++) {
+        if (containers[i] == nullptr) {
+            continue;
+        }
+        if (other.containers[i] == nullptr) {
+            containers[i].reset();
+            continue;
+        }
+        containers[i]->intersectWith(*other.containers[i]);
+        if (containers[i]->isEmpty()) {
+            containers[i].reset();
+        }
+    }
+}
+
+uint64_t RoaringBitmap::getCardinality() const {
+    uint64_t cardinality = 0;
+    for (auto& container : containers) {
+        if (container != nullptr) {
+            cardinality += container->getCardinality();
+        }
+    }
+    return cardinality;
+}
+
+} // namespace common
+} // namespace kuzu
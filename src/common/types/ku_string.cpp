@@ -54,7 +54,11 @@ bool ku_string_t::operator==(const ku_string_t& rhs) const {
         sizeof(uint32_t) +
         std::min((uint64_t)len, static_cast<uint64_t>(ku_string_t::PREFIX_LENGTH));
     if (!memcmp(this, &rhs, numBytesOfLenAndPrefix)) {
-        // If length and prefix of a and b are equal, we compare the overflow buffer.
+        // If length and prefix of a and b are equal, we compare the overflow buffer, unless both
+        // strings point to the same one.
+        if (!isShortString(len) && overflowPtr == rhs.overflowPtr) {
+            return true;
+        }
         return !memcmp(getData(), rhs.getData(), len);
     }
     return false;
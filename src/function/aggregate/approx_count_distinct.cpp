@@ -0,0 +1,90 @@
+#include "function/aggregate/approx_count_distinct.h"
+
+#include "common/type_utils.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate_function.h"
+#include "function/hash/hyper_log_log.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+// The sketch is stored inline in the state, so the states of different threads are merged by
+// merging their sketches.
+struct HyperLogLogState : public AggregateState {
+    HyperLogLogState() { isNull = false; }
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void moveResultToVector(common::ValueVector* outputVector, uint64_t pos) override {
+        outputVector->setValue<int64_t>(pos, sketch.estimate());
+    }
+
+    HyperLogLog sketch;
+};
+
+template<typename T>
+struct ApproxCountDistinct {
+    static std::unique_ptr<AggregateState> initialize() {
+        return std::make_unique<HyperLogLogState>();
+    }
+
+    static void updateAll(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/,
+        MemoryManager* /*memoryManager*/) {
+        KU_ASSERT(!input->state->isFlat());
+        auto state = reinterpret_cast<HyperLogLogState*>(state_);
+        auto& inputSelVector = input->state->getSelVector();
+        for (auto i = 0u; i < inputSelVector.getSelSize(); ++i) {
+            auto pos = inputSelVector[i];
+            if (!input->isNull(pos)) {
+                updateSingleValue(state, input, pos);
+            }
+        }
+    }
+
+    static void updatePos(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/,
+        uint32_t pos, MemoryManager* /*memoryManager*/) {
+        updateSingleValue(reinterpret_cast<HyperLogLogState*>(state_), input, pos);
+    }
+
+    static void updateSingleValue(HyperLogLogState* state, ValueVector* input, uint32_t pos) {
+        hash_t hash = 0;
+        Hash::operation(input->getValue<T>(pos), hash);
+        state->sketch.add(hash);
+    }
+
+    static void combine(uint8_t* state_, uint8_t* otherState_, MemoryManager* /*memoryManager*/) {
+        reinterpret_cast<HyperLogLogState*>(state_)->sketch.merge(
+            reinterpret_cast<HyperLogLogState*>(otherState_)->sketch);
+    }
+
+    static void finalize(uint8_t* /*state_*/) {}
+};
+
+function_set ApproxCountDistinctFunction::getFunctionSet() {
+    function_set result;
+    auto inputTypes = LogicalTypeUtils::getAllValidComparableLogicalTypes();
+    inputTypes.push_back(LogicalTypeID::INTERNAL_ID);
+    inputTypes.push_back(LogicalTypeID::NODE);
+    inputTypes.push_back(LogicalTypeID::REL);
+    for (auto typeID : inputTypes) {
+        // Nodes and rels are rewritten to their internal IDs.
+        auto physicalType = typeID == LogicalTypeID::NODE || typeID == LogicalTypeID::REL ?
+                                PhysicalTypeID::INTERNAL_ID :
+                                LogicalType::getPhysicalType(typeID);
+        for (auto isDistinct : std::vector<bool>{true, false}) {
+            TypeUtils::visit(
+                physicalType,
+                [&]<HashableNonNestedTypes T>(T) {
+                    result.push_back(AggregateFunctionUtil::getAggFunc<ApproxCountDistinct<T>>(
+                        name, typeID, LogicalTypeID::INT64, isDistinct,
+                        CountFunction::paramRewriteFunc));
+                },
+                [](auto) { KU_UNREACHABLE; });
+        }
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,358 @@
+#include "function/aggregate/quantile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "binder/expression/expression_util.h"
+#include "common/cast.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/type_utils.h"
+#include "common/types/int128_t.h"
+#include "function/aggregate_function.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+template<typename T>
+static double toDouble(T value) {
+    if constexpr (std::is_same_v<T, int128_t>) {
+        return Int128_t::Cast<double>(value);
+    } else {
+        return (double)value;
+    }
+}
+
+// Merging t-digest (Dunning & Ertl). Values are buffered and periodically merged into a sorted
+// list of centroids. The k1 scale function bounds the weight of each centroid so that centroids
+// near the tails stay small, which keeps extreme quantiles accurate with a bounded number of
+// centroids.
+class TDigest {
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+public:
+    static constexpr double COMPRESSION = 100;
+    static constexpr uint64_t BUFFER_SIZE = 5 * COMPRESSION;
+
+    void add(double value, uint64_t weight) {
+        buffer.push_back({value, (double)weight});
+        min = std::min(min, value);
+        max = std::max(max, value);
+        if (buffer.size() >= BUFFER_SIZE) {
+            compress();
+        }
+    }
+
+    void merge(const TDigest& other) {
+        buffer.insert(buffer.end(), other.centroids.begin(), other.centroids.end());
+        buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        compress();
+    }
+
+    double getQuantile(double fraction) {
+        compress();
+        KU_ASSERT(!centroids.empty());
+        // Centroid i is centered at rank (cumulative weight before i) + (weight_i - 1) / 2, so that
+        // singletons sit at their exact rank and small inputs give the same result as
+        // QUANTILE_CONT. The min and max are at rank 0 and totalWeight - 1.
+        const auto target = fraction * (totalWeight - 1);
+        auto prevRank = 0.0, prevValue = min, cumulativeWeight = 0.0;
+        for (auto& centroid : centroids) {
+            const auto rank = cumulativeWeight + (centroid.weight - 1) / 2;
+            if (target <= rank) {
+                if (rank == prevRank) {
+                    return centroid.mean;
+                }
+                return prevValue +
+                       (centroid.mean - prevValue) * (target - prevRank) / (rank - prevRank);
+            }
+            prevRank = rank;
+            prevValue = centroid.mean;
+            cumulativeWeight += centroid.weight;
+        }
+        const auto lastRank = totalWeight - 1;
+        if (lastRank == prevRank) {
+            return prevValue;
+        }
+        return prevValue + (max - prevValue) * (target - prevRank) / (lastRank - prevRank);
+    }
+
+private:
+    static double scale(double q) {
+        return COMPRESSION / (2 * std::numbers::pi) * std::asin(2 * q - 1);
+    }
+    static double inverseScale(double k) {
+        if (k >= COMPRESSION / 4) {
+            return 1;
+        }
+        return (std::sin(k * 2 * std::numbers::pi / COMPRESSION) + 1) / 2;
+    }
+
+    void compress() {
+        if (buffer.empty()) {
+            return;
+        }
+        buffer.insert(buffer.end(), centroids.begin(), centroids.end());
+        std::sort(buffer.begin(), buffer.end(),
+            [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+        totalWeight = 0;
+        for (auto& centroid : buffer) {
+            totalWeight += centroid.weight;
+        }
+        centroids.clear();
+        auto current = buffer[0];
+        auto weightSoFar = 0.0;
+        auto weightLimit = totalWeight * inverseScale(scale(0) + 1);
+        for (auto i = 1u; i < buffer.size(); i++) {
+            auto& next = buffer[i];
+            if (weightSoFar + current.weight + next.weight <= weightLimit) {
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            } else {
+                weightSoFar += current.weight;
+                centroids.push_back(current);
+                current = next;
+                weightLimit = totalWeight * inverseScale(scale(weightSoFar / totalWeight) + 1);
+            }
+        }
+        centroids.push_back(current);
+        buffer.clear();
+    }
+
+private:
+    std::vector<Centroid> centroids;
+    std::vector<Centroid> buffer;
+    double totalWeight = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+};
+
+// The fraction is bound from the second argument and set on the initial null state, from which
+// the state of every group is copied.
+struct QuantileState : public AggregateState {
+    double fraction = 0.5;
+};
+
+// Quantile states hold their values on the heap. The memory is released once the result has been
+// moved out, or by the aggregate hash table if the state is never scanned.
+template<typename T, bool DISCRETE>
+struct ExactQuantileState : public QuantileState {
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void moveResultToVector(ValueVector* outputVector, uint64_t pos) override {
+        auto& data = *values;
+        const auto numValues = data.size();
+        if constexpr (DISCRETE) {
+            auto idx = (uint64_t)std::max(std::ceil(fraction * numValues) - 1, 0.0);
+            std::nth_element(data.begin(), data.begin() + idx, data.end());
+            outputVector->setValue<T>(pos, data[idx]);
+        } else {
+            const auto rank = fraction * (numValues - 1);
+            const auto lowIdx = (uint64_t)std::floor(rank);
+            std::nth_element(data.begin(), data.begin() + lowIdx, data.end());
+            auto result = toDouble(data[lowIdx]);
+            if (lowIdx + 1 < numValues && rank > lowIdx) {
+                const auto high =
+                    toDouble(*std::min_element(data.begin() + lowIdx + 1, data.end()));
+                result += (high - result) * (rank - lowIdx);
+            }
+            outputVector->setValue<double>(pos, result);
+        }
+        values.reset();
+    }
+
+    std::unique_ptr<std::vector<T>> values;
+};
+
+template<typename T>
+struct TDigestState : public QuantileState {
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void moveResultToVector(ValueVector* outputVector, uint64_t pos) override {
+        outputVector->setValue<double>(pos, digest->getQuantile(fraction));
+        digest.reset();
+    }
+
+    std::unique_ptr<TDigest> digest;
+};
+
+template<typename T, bool DISCRETE>
+struct ExactQuantile {
+    using State = ExactQuantileState<T, DISCRETE>;
+
+    static std::unique_ptr<AggregateState> initialize() { return std::make_unique<State>(); }
+
+    static void updateSingleValue(State* state, ValueVector* input, uint32_t pos,
+        uint64_t multiplicity) {
+        if (state->isNull) {
+            state->values = std::make_unique<std::vector<T>>();
+            state->isNull = false;
+        }
+        state->values->insert(state->values->end(), multiplicity, input->getValue<T>(pos));
+    }
+
+    static void combine(uint8_t* state_, uint8_t* otherState_, MemoryManager* /*memoryManager*/) {
+        auto otherState = reinterpret_cast<State*>(otherState_);
+        if (otherState->isNull) {
+            return;
+        }
+        auto state = reinterpret_cast<State*>(state_);
+        if (state->isNull) {
+            state->values = std::move(otherState->values);
+            state->isNull = false;
+        } else {
+            state->values->insert(state->values->end(), otherState->values->begin(),
+                otherState->values->end());
+            otherState->values.reset();
+        }
+    }
+};
+
+template<typename T>
+struct ApproxQuantile {
+    using State = TDigestState<T>;
+
+    static std::unique_ptr<AggregateState> initialize() { return std::make_unique<State>(); }
+
+    static void updateSingleValue(State* state, ValueVector* input, uint32_t pos,
+        uint64_t multiplicity) {
+        if (state->isNull) {
+            state->digest = std::make_unique<TDigest>();
+            state->isNull = false;
+        }
+        state->digest->add(toDouble(input->getValue<T>(pos)), multiplicity);
+    }
+
+    static void combine(uint8_t* state_, uint8_t* otherState_, MemoryManager* /*memoryManager*/) {
+        auto otherState = reinterpret_cast<State*>(otherState_);
+        if (otherState->isNull) {
+            return;
+        }
+        auto state = reinterpret_cast<State*>(state_);
+        if (state->isNull) {
+            state->digest = std::move(otherState->digest);
+            state->isNull = false;
+        } else {
+            state->digest->merge(*otherState->digest);
+            otherState->digest.reset();
+        }
+    }
+};
+
+// Adds the update and finalize functions shared by the quantile aggregates to IMPL.
+template<typename IMPL>
+struct QuantileFunction : public IMPL {
+    using State = typename IMPL::State;
+
+    static void updateAll(uint8_t* state_, ValueVector* input, uint64_t multiplicity,
+        MemoryManager* /*memoryManager*/) {
+        KU_ASSERT(!input->state->isFlat());
+        auto state = reinterpret_cast<State*>(state_);
+        auto& inputSelVector = input->state->getSelVector();
+        if (input->hasNoNullsGuarantee()) {
+            for (auto i = 0u; i < inputSelVector.getSelSize(); ++i) {
+                IMPL::updateSingleValue(state, input, inputSelVector[i], multiplicity);
+            }
+        } else {
+            for (auto i = 0u; i < inputSelVector.getSelSize(); ++i) {
+                auto pos = inputSelVector[i];
+                if (!input->isNull(pos)) {
+                    IMPL::updateSingleValue(state, input, pos, multiplicity);
+                }
+            }
+        }
+    }
+
+    static void updatePos(uint8_t* state_, ValueVector* input, uint64_t multiplicity,
+        uint32_t pos, MemoryManager* /*memoryManager*/) {
+        IMPL::updateSingleValue(reinterpret_cast<State*>(state_), input, pos, multiplicity);
+    }
+
+    static void finalize(uint8_t* /*state_*/) {}
+};
+
+static std::unique_ptr<FunctionBindData> bindFraction(ScalarBindFuncInput input) {
+    KU_ASSERT(input.arguments.size() == 2);
+    auto aggFuncDefinition = reinterpret_cast<AggregateFunction*>(input.definition);
+    auto fraction = ExpressionUtil::getLiteralValue<double>(*input.arguments[1]);
+    if (fraction < 0 || fraction > 1) {
+        throw BinderException(
+            stringFormat("The fraction of {} must be between 0 and 1, but got {}.",
+                aggFuncDefinition->name, fraction));
+    }
+    auto initializeFunc = aggFuncDefinition->initializeFunc;
+    aggFuncDefinition->initializeFunc = [initializeFunc, fraction]() {
+        auto state = initializeFunc();
+        ku_dynamic_cast<QuantileState*>(state.get())->fraction = fraction;
+        return state;
+    };
+    aggFuncDefinition->initialNullAggregateState =
+        aggFuncDefinition->createInitialNullAggregateState();
+    return std::make_unique<FunctionBindData>(LogicalType(aggFuncDefinition->returnTypeID));
+}
+
+template<template<typename> class FUNC>
+static function_set getQuantileFunctionSet(const std::string& name, bool isDiscrete,
+    bool hasFraction) {
+    function_set result;
+    for (auto typeID : LogicalTypeUtils::getNumericalLogicalTypeIDs()) {
+        auto parameterTypeIDs = std::vector<LogicalTypeID>{typeID};
+        if (hasFraction) {
+            parameterTypeIDs.push_back(LogicalTypeID::DOUBLE);
+        }
+        auto resultTypeID = LogicalTypeID::DOUBLE;
+        if (isDiscrete) {
+            resultTypeID = typeID == LogicalTypeID::SERIAL ? LogicalTypeID::INT64 : typeID;
+        }
+        for (auto isDistinct : std::vector<bool>{true, false}) {
+            TypeUtils::visit(
+                LogicalType::getPhysicalType(typeID),
+                [&]<NumericTypes T>(T) {
+                    using F = QuantileFunction<FUNC<T>>;
+                    result.push_back(std::make_unique<AggregateFunction>(name, parameterTypeIDs,
+                        resultTypeID, F::initialize, F::updateAll, F::updatePos, F::combine,
+                        F::finalize, isDistinct, hasFraction ? bindFraction : nullptr,
+                        nullptr /* paramRewriteFunc */));
+                },
+                [](auto) { KU_UNREACHABLE; });
+        }
+    }
+    return result;
+}
+
+template<typename T>
+using ExactQuantileCont = ExactQuantile<T, false /* DISCRETE */>;
+template<typename T>
+using ExactQuantileDisc = ExactQuantile<T, true /* DISCRETE */>;
+
+function_set QuantileContFunction::getFunctionSet() {
+    return getQuantileFunctionSet<ExactQuantileCont>(name, false /* isDiscrete */,
+        true /* hasFraction */);
+}
+
+function_set QuantileDiscFunction::getFunctionSet() {
+    return getQuantileFunctionSet<ExactQuantileDisc>(name, true /* isDiscrete */,
+        true /* hasFraction */);
+}
+
+function_set MedianFunction::getFunctionSet() {
+    return getQuantileFunctionSet<ExactQuantileCont>(name, false /* isDiscrete */,
+        false /* hasFraction */);
+}
+
+function_set ApproxQuantileFunction::getFunctionSet() {
+    return getQuantileFunctionSet<ApproxQuantile>(name, false /* isDiscrete */,
+        true /* hasFraction */);
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,25 +1,71 @@
+#include <atomic>
+#include <cstdio>
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_serializer.h"
+#include "common/string_utils.h"
+#include "common/types/cast_helpers.h"
+#include "common/types/timestamp_t.h"
 #include "function/cast/vector_cast_functions.h"
 #include "function/export/export_function.h"
 #include "function/scalar_function.h"
 #include "main/client_context.h"
+#include "miniz_wrapper.hpp"
+#include "zstd.h"
 
 namespace kuzu {
 namespace function {
 
 using namespace common;
 
+enum class CSVCompression : uint8_t { NONE = 0, GZIP = 1, ZSTD = 2 };
+
 struct ExportCSVBindData : public ExportFuncBindData {
     CSVOption exportOption;
+    // Each thread writes its rows to its own file, named after the output file with the index of
+    // the shard appended to its stem (e.g. out_0.csv, out_1.csv).
+    bool perThreadOutput;
+    CSVCompression compression;
 
-    ExportCSVBindData(std::vector<std::string> names, std::string fileName, CSVOption exportOption)
+    ExportCSVBindData(std::vector<std::string> names, std::string fileName, CSVOption exportOption,
+        bool perThreadOutput, CSVCompression compression)
         : ExportFuncBindData{std::move(names), std::move(fileName)},
-          exportOption{std::move(exportOption)} {}
+          exportOption{std::move(exportOption)}, perThreadOutput{perThreadOutput},
+          compression{compression} {}
+
+    std::string getFilePath(uint64_t shardIdx) const {
+        auto filePath = fileName;
+        if (perThreadOutput) {
+            auto extensionPos = filePath.rfind('.');
+            auto separatorPos = filePath.find_last_of("/\\");
+            if (extensionPos == std::string::npos ||
+                (separatorPos != std::string::npos && extensionPos < separatorPos)) {
+                extensionPos = filePath.size();
+            }
+            filePath.insert(extensionPos, "_" + std::to_string(shardIdx));
+        }
+        switch (compression) {
+        case CSVCompression::GZIP:
+            return filePath + ExportCSVConstants::GZIP_FILE_SUFFIX;
+        case CSVCompression::ZSTD:
+            return filePath + ExportCSVConstants::ZSTD_FILE_SUFFIX;
+        default:
+            return filePath;
+        }
+    }
+
+    uint64_t getFlushSize() const {
+        return compression == CSVCompression::NONE ?
+                   ExportCSVConstants::DEFAULT_CSV_FLUSH_SIZE :
+                   ExportCSVConstants::DEFAULT_COMPRESSED_CSV_FLUSH_SIZE;
+    }
 
     std::unique_ptr<ExportFuncBindData> copy() const override {
-        auto bindData =
-            std::make_unique<ExportCSVBindData>(columnNames, fileName, exportOption.copy());
+        auto bindData = std::make_unique<ExportCSVBindData>(columnNames, fileName,
+            exportOption.copy(), perThreadOutput, compression);
         bindData->types = LogicalType::copy(types);
         return bindData;
     }
@@ -100,53 +146,240 @@ static void writeString(BufferedSerializer* serializer, const ExportFuncBindData
     }
 }
 
+static void writeHeader(BufferedSerializer& serializer, const ExportCSVBindData& bindData) {
+    if (!bindData.exportOption.hasHeader) {
+        return;
+    }
+    for (auto i = 0u; i < bindData.columnNames.size(); i++) {
+        if (i != 0) {
+            serializer.writeBufferData(bindData.exportOption.delimiter);
+        }
+        auto& name = bindData.columnNames[i];
+        writeString(&serializer, bindData, reinterpret_cast<const uint8_t*>(name.c_str()),
+            name.length(), false /* forceQuote */);
+    }
+    serializer.writeBufferData(ExportCSVConstants::DEFAULT_CSV_NEWLINE);
+}
+
+// Compresses the data as a self-contained gzip member or zstd frame. A file of concatenated members
+// or frames decompresses to the concatenation of their contents, so every flushed buffer can be
+// compressed on its own, outside of any lock.
+static uint64_t compressBuffer(CSVCompression compression, const uint8_t* data, uint64_t size,
+    std::vector<uint8_t>& result) {
+    switch (compression) {
+    case CSVCompression::GZIP: {
+        MiniZStream stream;
+        size_t compressedSize = stream.MaxCompressedLength(size);
+        result.resize(compressedSize);
+        stream.Compress(reinterpret_cast<const char*>(data), size,
+            reinterpret_cast<char*>(result.data()), &compressedSize);
+        return compressedSize;
+    }
+    case CSVCompression::ZSTD: {
+        result.resize(kuzu_zstd::ZSTD_compressBound(size));
+        auto compressedSize = kuzu_zstd::ZSTD_compress(result.data(), result.size(), data, size,
+            ZSTD_CLEVEL_DEFAULT);
+        if (kuzu_zstd::ZSTD_isError(compressedSize)) {
+            throw RuntimeException{stringFormat("Failed to compress CSV data: {}.",
+                kuzu_zstd::ZSTD_getErrorName(compressedSize))};
+        }
+        return compressedSize;
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 struct ExportCSVSharedState : public ExportFuncSharedState {
     std::mutex mtx;
     std::unique_ptr<FileInfo> fileInfo;
     offset_t offset = 0;
+    main::ClientContext* context = nullptr;
+    const ExportCSVBindData* bindData = nullptr;
+    // Number of files created with per thread output.
+    std::atomic<uint64_t> numShards = 0;
 
     ExportCSVSharedState() = default;
 
-    void init(main::ClientContext& context, const ExportFuncBindData& bindData) override {
-        fileInfo = context.getVFSUnsafe()->openFile(bindData.fileName,
-            FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS, &context);
-        writeHeader(bindData);
-    }
-
-    void writeHeader(const ExportFuncBindData& bindData) {
-        auto& exportCSVBindData = bindData.constCast<ExportCSVBindData>();
+    void init(main::ClientContext& context_, const ExportFuncBindData& bindData_) override {
+        context = &context_;
+        bindData = &bindData_.constCast<ExportCSVBindData>();
+        if (bindData->perThreadOutput) {
+            // Threads create their files when they first flush rows.
+            return;
+        }
+        fileInfo = openFile(0 /* shardIdx */);
         BufferedSerializer bufferedSerializer;
-        if (exportCSVBindData.exportOption.hasHeader) {
-            for (auto i = 0u; i < exportCSVBindData.columnNames.size(); i++) {
-                if (i != 0) {
-                    bufferedSerializer.writeBufferData(exportCSVBindData.exportOption.delimiter);
-                }
-                auto& name = exportCSVBindData.columnNames[i];
-                writeString(&bufferedSerializer, exportCSVBindData,
-                    reinterpret_cast<const uint8_t*>(name.c_str()), name.length(),
-                    false /* forceQuote */);
-            }
-            bufferedSerializer.writeBufferData(ExportCSVConstants::DEFAULT_CSV_NEWLINE);
-            writeRows(bufferedSerializer.getBlobData(), bufferedSerializer.getSize());
+        writeHeader(bufferedSerializer, *bindData);
+        if (bufferedSerializer.getSize() > 0) {
+            std::vector<uint8_t> compressedBuffer;
+            writeRows(bufferedSerializer.getBlobData(), bufferedSerializer.getSize(),
+                compressedBuffer);
         }
     }
 
-    void writeRows(const uint8_t* data, uint64_t size) {
+    std::unique_ptr<FileInfo> openFile(uint64_t shardIdx) const {
+        return context->getVFSUnsafe()->openFile(bindData->getFilePath(shardIdx),
+            FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS, context);
+    }
+
+    void writeRows(const uint8_t* data, uint64_t size, std::vector<uint8_t>& compressedBuffer) {
+        if (bindData->compression != CSVCompression::NONE) {
+            size = compressBuffer(bindData->compression, data, size, compressedBuffer);
+            data = compressedBuffer.data();
+        }
         std::lock_guard<std::mutex> lck(mtx);
         fileInfo->writeFile(data, size, offset);
         offset += size;
     }
 };
 
+// Writes a value of a non-nested type straight into the serializer, producing the same text as
+// casting it to STRING would without materializing an intermediate string vector.
+using csv_value_writer_t = void (*)(BufferedSerializer&, const ExportCSVBindData&,
+    const ValueVector&, sel_t);
+
+static void writeFormatted(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const char* data, uint64_t length) {
+    writeString(&serializer, bindData, reinterpret_cast<const uint8_t*>(data), length,
+        ExportCSVConstants::DEFAULT_FORCE_QUOTE);
+}
+
+static void writeBool(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    if (vector.getValue<bool>(pos)) {
+        writeFormatted(serializer, bindData, "True", 4);
+    } else {
+        writeFormatted(serializer, bindData, "False", 5);
+    }
+}
+
+template<typename T>
+static void writeInteger(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    using unsigned_t = std::make_unsigned_t<T>;
+    char buffer[24];
+    auto end = buffer + sizeof(buffer);
+    auto value = vector.getValue<T>(pos);
+    char* begin = nullptr;
+    if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+            begin = NumericHelper::FormatUnsigned(unsigned_t(0) - static_cast<unsigned_t>(value),
+                end);
+            *--begin = '-';
+        } else {
+            begin = NumericHelper::FormatUnsigned(static_cast<unsigned_t>(value), end);
+        }
+    } else {
+        begin = NumericHelper::FormatUnsigned(value, end);
+    }
+    writeFormatted(serializer, bindData, begin, end - begin);
+}
+
+template<typename T>
+static void writeFloatingPoint(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    // Same format as std::to_string. The longest value, -DBL_MAX, has 316 characters.
+    char buffer[512];
+    auto value = static_cast<double>(vector.getValue<T>(pos));
+    auto length = snprintf(buffer, sizeof(buffer), "%f", value);
+    writeFormatted(serializer, bindData, buffer, length);
+}
+
+static uint64_t formatDate(char* buffer, date_t date) {
+    int32_t dateUnits[3];
+    uint64_t yearLength = 0;
+    bool addBC = false;
+    Date::convert(date, dateUnits[0], dateUnits[1], dateUnits[2]);
+    auto length = DateToStringCast::Length(dateUnits, yearLength, addBC);
+    DateToStringCast::Format(buffer, dateUnits, yearLength, addBC);
+    return length;
+}
+
+static void writeDate(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    char buffer[32];
+    auto length = formatDate(buffer, vector.getValue<date_t>(pos));
+    writeFormatted(serializer, bindData, buffer, length);
+}
+
+static void writeTimestamp(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    char buffer[64];
+    date_t date;
+    dtime_t time;
+    Timestamp::convert(vector.getValue<timestamp_t>(pos), date, time);
+    auto length = formatDate(buffer, date);
+    buffer[length++] = ' ';
+    int32_t timeUnits[4];
+    char microBuffer[6];
+    Time::convert(time, timeUnits[0], timeUnits[1], timeUnits[2], timeUnits[3]);
+    auto timeLength = TimeToStringCast::Length(timeUnits, microBuffer);
+    TimeToStringCast::Format(buffer + length, timeLength, timeUnits, microBuffer);
+    writeFormatted(serializer, bindData, buffer, length + timeLength);
+}
+
+static void writeStringValue(BufferedSerializer& serializer, const ExportCSVBindData& bindData,
+    const ValueVector& vector, sel_t pos) {
+    auto& value = vector.getValue<ku_string_t>(pos);
+    writeFormatted(serializer, bindData, reinterpret_cast<const char*>(value.getData()),
+        value.len);
+}
+
+static csv_value_writer_t getValueWriter(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+        return writeBool;
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return writeInteger<int64_t>;
+    case LogicalTypeID::INT32:
+        return writeInteger<int32_t>;
+    case LogicalTypeID::INT16:
+        return writeInteger<int16_t>;
+    case LogicalTypeID::INT8:
+        return writeInteger<int8_t>;
+    case LogicalTypeID::UINT64:
+        return writeInteger<uint64_t>;
+    case LogicalTypeID::UINT32:
+        return writeInteger<uint32_t>;
+    case LogicalTypeID::UINT16:
+        return writeInteger<uint16_t>;
+    case LogicalTypeID::UINT8:
+        return writeInteger<uint8_t>;
+    case LogicalTypeID::DOUBLE:
+        return writeFloatingPoint<double>;
+    case LogicalTypeID::FLOAT:
+        return writeFloatingPoint<float>;
+    case LogicalTypeID::DATE:
+        return writeDate;
+    case LogicalTypeID::TIMESTAMP:
+        return writeTimestamp;
+    case LogicalTypeID::STRING:
+        return writeStringValue;
+    default:
+        return nullptr;
+    }
+}
+
 struct ExportCSVLocalState final : public ExportFuncLocalState {
+    main::ClientContext* context;
+    const ExportCSVBindData* bindData;
     std::unique_ptr<BufferedSerializer> serializer;
     std::unique_ptr<DataChunk> unflatCastDataChunk;
     std::unique_ptr<DataChunk> flatCastDataChunk;
     std::vector<ValueVector*> castVectors;
+    // Columns with a value writer are formatted directly; the others are cast to STRING first.
+    std::vector<csv_value_writer_t> valueWriters;
     std::vector<function::scalar_func_exec_t> castFuncs;
+    std::vector<uint8_t> compressedBuffer;
+    // The file this thread writes to with per thread output.
+    std::unique_ptr<FileInfo> fileInfo;
+    offset_t offset = 0;
 
     ExportCSVLocalState(main::ClientContext& context, const ExportFuncBindData& bindData,
-        std::vector<bool> isFlatVec) {
+        std::vector<bool> isFlatVec)
+        : context{&context}, bindData{&bindData.constCast<ExportCSVBindData>()} {
         auto& exportCSVBindData = bindData.constCast<ExportCSVBindData>();
         serializer = std::make_unique<BufferedSerializer>();
         auto numFlatVectors = std::count(isFlatVec.begin(), isFlatVec.end(), true /* isFlat */);
@@ -155,10 +388,14 @@ struct ExportCSVLocalState final : public ExportFuncLocalState {
             DataChunkState::getSingleValueDataChunkState());
         uint64_t numInsertedFlatVector = 0;
         castFuncs.resize(exportCSVBindData.types.size());
+        valueWriters.resize(exportCSVBindData.types.size());
         for (auto i = 0u; i < exportCSVBindData.types.size(); i++) {
-            castFuncs[i] = function::CastFunction::bindCastFunction("cast",
-                exportCSVBindData.types[i], LogicalType::STRING())
-                               ->execFunc;
+            valueWriters[i] = getValueWriter(exportCSVBindData.types[i]);
+            if (valueWriters[i] == nullptr) {
+                castFuncs[i] = function::CastFunction::bindCastFunction("cast",
+                    exportCSVBindData.types[i], LogicalType::STRING())
+                                   ->execFunc;
+            }
             auto castVector =
                 std::make_unique<ValueVector>(LogicalTypeID::STRING, context.getMemoryManager());
             castVectors.push_back(castVector.get());
@@ -170,11 +407,81 @@ struct ExportCSVLocalState final : public ExportFuncLocalState {
             }
         }
     }
+
+    void flush(ExportCSVSharedState& sharedState) {
+        if (!bindData->perThreadOutput) {
+            sharedState.writeRows(serializer->getBlobData(), serializer->getSize(),
+                compressedBuffer);
+            serializer->reset();
+            return;
+        }
+        if (fileInfo == nullptr) {
+            fileInfo = sharedState.openFile(sharedState.numShards.fetch_add(1));
+            BufferedSerializer headerSerializer;
+            writeHeader(headerSerializer, *bindData);
+            writeToFile(headerSerializer.getBlobData(), headerSerializer.getSize());
+        }
+        writeToFile(serializer->getBlobData(), serializer->getSize());
+        serializer->reset();
+    }
+
+private:
+    void writeToFile(const uint8_t* data, uint64_t size) {
+        if (size == 0) {
+            return;
+        }
+        if (bindData->compression != CSVCompression::NONE) {
+            size = compressBuffer(bindData->compression, data, size, compressedBuffer);
+            data = compressedBuffer.data();
+        }
+        fileInfo->writeFile(data, size, offset);
+        offset += size;
+    }
 };
 
+static CSVCompression bindCompression(const Value& value) {
+    if (value.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        throw BinderException(stringFormat("The type of csv parsing option {} must be a string.",
+            ExportCSVConstants::COMPRESSION_OPTION));
+    }
+    auto compression = StringUtils::getUpper(value.getValue<std::string>());
+    if (compression == "NONE" || compression == "UNCOMPRESSED") {
+        return CSVCompression::NONE;
+    }
+    if (compression == "GZIP") {
+        return CSVCompression::GZIP;
+    }
+    if (compression == "ZSTD") {
+        return CSVCompression::ZSTD;
+    }
+    throw BinderException(
+        stringFormat("Unrecognized csv compression option: {}.", value.toString()));
+}
+
+static bool bindPerThreadOutput(const Value& value) {
+    if (value.getDataType().getLogicalTypeID() != LogicalTypeID::BOOL) {
+        throw BinderException(stringFormat("The type of csv parsing option {} must be a boolean.",
+            ExportCSVConstants::PER_THREAD_OUTPUT_OPTION));
+    }
+    return value.getValue<bool>();
+}
+
 static std::unique_ptr<ExportFuncBindData> bindFunc(ExportFuncBindInput& bindInput) {
+    auto& options = bindInput.parsingOptions;
+    auto perThreadOutput = false;
+    auto compression = CSVCompression::NONE;
+    if (options.contains(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION)) {
+        perThreadOutput =
+            bindPerThreadOutput(options.at(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION));
+        options.erase(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION);
+    }
+    if (options.contains(ExportCSVConstants::COMPRESSION_OPTION)) {
+        compression = bindCompression(options.at(ExportCSVConstants::COMPRESSION_OPTION));
+        options.erase(ExportCSVConstants::COMPRESSION_OPTION);
+    }
     return std::make_unique<ExportCSVBindData>(bindInput.columnNames, bindInput.filePath,
-        CSVReaderConfig::construct(std::move(bindInput.parsingOptions)).option.copy());
+        CSVReaderConfig::construct(std::move(options)).option.copy(), perThreadOutput,
+        compression);
 }
 
 static std::unique_ptr<ExportFuncLocalState> initLocalStateFunc(main::ClientContext& context,
@@ -195,8 +502,12 @@ static void writeRows(const ExportCSVBindData& exportCSVBindData, ExportCSVLocal
     std::vector<std::shared_ptr<ValueVector>> inputVectors) {
     auto& exportCSVLocalState = localState.cast<ExportCSVLocalState>();
     auto& castVectors = localState.castVectors;
+    auto& valueWriters = localState.valueWriters;
     auto& serializer = localState.serializer;
     for (auto i = 0u; i < inputVectors.size(); i++) {
+        if (valueWriters[i] != nullptr) {
+            continue;
+        }
         auto vectorToCast = {inputVectors[i]};
         exportCSVLocalState.castFuncs[i](vectorToCast, *castVectors[i], nullptr /* dataPtr */);
     }
@@ -213,9 +524,20 @@ static void writeRows(const ExportCSVBindData& exportCSVBindData, ExportCSVLocal
             if (j != 0) {
                 serializer->writeBufferData(exportCSVBindData.exportOption.delimiter);
             }
+            auto& inputVector = inputVectors[j];
+            if (valueWriters[j] != nullptr) {
+                auto& selVector = inputVector->state->getSelVector();
+                auto pos = inputVector->state->isFlat() ? selVector[0] : selVector[i];
+                if (inputVector->isNull(pos)) {
+                    serializer->writeBufferData(ExportCSVConstants::DEFAULT_NULL_STR);
+                } else {
+                    valueWriters[j](*serializer, exportCSVBindData, *inputVector, pos);
+                }
+                continue;
+            }
             auto vector = castVectors[j];
             auto pos = vector->state->isFlat() ? vector->state->getSelVector()[0] :
-                                                 inputVectors[j]->state->getSelVector()[i];
+                                                 inputVector->state->getSelVector()[i];
             if (vector->isNull(pos)) {
                 // write null value
                 serializer->writeBufferData(ExportCSVConstants::DEFAULT_NULL_STR);
@@ -225,7 +547,7 @@ static void writeRows(const ExportCSVBindData& exportCSVBindData, ExportCSVLocal
             // Note: we need blindly add quotes to LIST.
             writeString(serializer.get(), exportCSVBindData, strValue.getData(), strValue.len,
                 ExportCSVConstants::DEFAULT_FORCE_QUOTE ||
-                    inputVectors[j]->dataType.getLogicalTypeID() == LogicalTypeID::LIST);
+                    inputVector->dataType.getLogicalTypeID() == LogicalTypeID::LIST);
         }
         serializer->writeBufferData(ExportCSVConstants::DEFAULT_CSV_NEWLINE);
     }
@@ -236,24 +558,34 @@ static void sinkFunc(ExportFuncSharedState& sharedState, ExportFuncLocalState& l
     auto& exportCSVLocalState = localState.cast<ExportCSVLocalState>();
     auto& exportCSVBindData = bindData.constCast<ExportCSVBindData>();
     writeRows(exportCSVBindData, exportCSVLocalState, std::move(inputVectors));
-    auto& serializer = exportCSVLocalState.serializer;
-    if (serializer->getSize() > ExportCSVConstants::DEFAULT_CSV_FLUSH_SIZE) {
-        auto& exportCSVSharedState = sharedState.cast<ExportCSVSharedState>();
-        exportCSVSharedState.writeRows(serializer->getBlobData(), serializer->getSize());
-        serializer->reset();
+    if (exportCSVLocalState.serializer->getSize() > exportCSVBindData.getFlushSize()) {
+        exportCSVLocalState.flush(sharedState.cast<ExportCSVSharedState>());
     }
 }
 
 static void combineFunc(ExportFuncSharedState& sharedState, ExportFuncLocalState& localState) {
-    auto& serializer = localState.cast<ExportCSVLocalState>().serializer;
-    auto& exportCSVSharedState = sharedState.cast<ExportCSVSharedState>();
-    if (serializer->getSize() > 0) {
-        exportCSVSharedState.writeRows(serializer->getBlobData(), serializer->getSize());
-        serializer->reset();
+    auto& exportCSVLocalState = localState.cast<ExportCSVLocalState>();
+    if (exportCSVLocalState.serializer->getSize() > 0) {
+        exportCSVLocalState.flush(sharedState.cast<ExportCSVSharedState>());
     }
 }
 
-static void finalizeFunc(ExportFuncSharedState&) {}
+static void finalizeFunc(ExportFuncSharedState& sharedState) {
+    auto& exportCSVSharedState = sharedState.cast<ExportCSVSharedState>();
+    if (!exportCSVSharedState.bindData->perThreadOutput || exportCSVSharedState.numShards > 0) {
+        return;
+    }
+    // No thread wrote any rows. Still create a file, so that the output can be read back.
+    exportCSVSharedState.fileInfo = exportCSVSharedState.openFile(0 /* shardIdx */);
+    exportCSVSharedState.numShards = 1;
+    BufferedSerializer bufferedSerializer;
+    writeHeader(bufferedSerializer, *exportCSVSharedState.bindData);
+    if (bufferedSerializer.getSize() > 0) {
+        std::vector<uint8_t> compressedBuffer;
+        exportCSVSharedState.writeRows(bufferedSerializer.getBlobData(),
+            bufferedSerializer.getSize(), compressedBuffer);
+    }
+}
 
 function_set ExportCSVFunction::getFunctionSet() {
     function_set functionSet;
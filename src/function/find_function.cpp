@@ -1,7 +1,12 @@
 #include "function/string/functions/find_function.h"
 
+#include <bit>
 #include <cstring>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -90,9 +95,7 @@ int64_t Find::genericFind(const uint8_t* haystack, uint32_t haystackLen, const u
     }
 }
 
-// Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
-// contain needle, it returns -1.
-int64_t Find::find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
+int64_t Find::scalarFind(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
     uint32_t needleLen) {
     auto firstMatchCharPos = (uint8_t*)memchr(haystack, needle[0], haystackLen);
     if (firstMatchCharPos == nullptr) {
@@ -126,5 +129,48 @@ int64_t Find::find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t*
     }
 }
 
+#if defined(__SSE2__)
+int64_t Find::simdFind(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
+    uint32_t needleLen) {
+    static constexpr uint32_t BLOCK_SIZE = sizeof(__m128i);
+    const auto firstChar = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const auto lastChar = _mm_set1_epi8(static_cast<char>(needle[needleLen - 1]));
+    auto offset = 0u;
+    for (; offset + needleLen - 1 + BLOCK_SIZE <= haystackLen; offset += BLOCK_SIZE) {
+        auto firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + offset));
+        auto lastBlock =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + offset + needleLen - 1));
+        auto matches = _mm_and_si128(_mm_cmpeq_epi8(firstChar, firstBlock),
+            _mm_cmpeq_epi8(lastChar, lastBlock));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+        while (mask != 0) {
+            auto pos = offset + std::countr_zero(mask);
+            if (memcmp(haystack + pos + 1, needle + 1, needleLen - 2) == 0) {
+                return pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+    // Positions that don't fill a whole block.
+    if (offset + needleLen > haystackLen) {
+        return -1;
+    }
+    auto result = scalarFind(haystack + offset, haystackLen - offset, needle, needleLen);
+    return result == -1 ? -1 : offset + result;
+}
+#endif
+
+// Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
+// contain needle, it returns -1.
+int64_t Find::find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
+    uint32_t needleLen) {
+#if defined(__SSE2__)
+    if (needleLen > 1) {
+        return simdFind(haystack, haystackLen, needle, needleLen);
+    }
+#endif
+    return scalarFind(haystack, haystackLen, needle, needleLen);
+}
+
 } // namespace function
 } // namespace kuzu
@@ -1,8 +1,10 @@
 #include "function/function_collection.h"
 
+#include "function/aggregate/approx_count_distinct.h"
 #include "function/aggregate/collect.h"
 #include "function/aggregate/count.h"
 #include "function/aggregate/count_star.h"
+#include "function/aggregate/quantile.h"
 #include "function/arithmetic/vector_arithmetic_functions.h"
 #include "function/array/vector_array_functions.h"
 #include "function/blob/vector_blob_functions.h"
@@ -212,7 +214,9 @@ FunctionCollection* FunctionCollection::getFunctions() {
         AGGREGATE_FUNCTION(CountStarFunction), AGGREGATE_FUNCTION(CountFunction),
         AGGREGATE_FUNCTION(AggregateSumFunction), AGGREGATE_FUNCTION(AggregateAvgFunction),
         AGGREGATE_FUNCTION(AggregateMinFunction), AGGREGATE_FUNCTION(AggregateMaxFunction),
-        AGGREGATE_FUNCTION(CollectFunction),
+        AGGREGATE_FUNCTION(CollectFunction), AGGREGATE_FUNCTION(ApproxCountDistinctFunction),
+        AGGREGATE_FUNCTION(QuantileContFunction), AGGREGATE_FUNCTION(QuantileDiscFunction),
+        AGGREGATE_FUNCTION(MedianFunction), AGGREGATE_FUNCTION(ApproxQuantileFunction),
 
         // Table functions
         TABLE_FUNCTION(CurrentSettingFunction), TABLE_FUNCTION(DBVersionFunction),
@@ -220,7 +224,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(ClearWarningsFunction), TABLE_FUNCTION(TableInfoFunction),
         TABLE_FUNCTION(ShowConnectionFunction), TABLE_FUNCTION(StorageInfoFunction),
         TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(ShowSequencesFunction),
-        TABLE_FUNCTION(ShowFunctionsFunction),
+        TABLE_FUNCTION(ShowFunctionsFunction), TABLE_FUNCTION(AnalyzeFunction),
+        TABLE_FUNCTION(SortAdjacencyListsFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -131,7 +131,7 @@ public:
                     auto iter = graph->scanFwd(nodeID, *scanState);
                     for (const auto [nodes, edges] : iter) {
                         for (const auto& nbr : nodes) {
-                            auto numNbrOfNbr = graph->scanFwd(nbr, *innerScanState).count();
+                            auto numNbrOfNbr = graph->countFwd(nbr, *innerScanState);
                             if (numNbrOfNbr == 0) {
                                 numNbrOfNbr = graph->getNumNodes();
                             }
@@ -159,10 +159,9 @@ void RJAlgorithm::exec(processor::ExecutionContext* executionContext) {
             continue;
         }
         auto mask = sharedState->inputNodeOffsetMasks.at(tableID).get();
-        for (auto offset = 0u; offset < sharedState->graph->getNumNodes(tableID); ++offset) {
-            if (!mask->isMasked(offset)) {
-                continue;
-            }
+        const auto numNodes = sharedState->graph->getNumNodes(tableID);
+        for (auto offset = mask->getNextMaskedOffset(0); offset < numNodes;
+             offset = mask->getNextMaskedOffset(offset + 1)) {
             auto sourceNodeID = nodeID_t{offset, tableID};
             RJCompState rjCompState = getRJCompState(executionContext, sourceNodeID);
             rjCompState.initSource(sourceNodeID);
@@ -0,0 +1,235 @@
+#include <algorithm>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/data_chunk/data_chunk.h"
+#include "common/exception/binder.h"
+#include "common/random_engine.h"
+#include "common/type_utils.h"
+#include "function/hash/hyper_log_log.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct AnalyzeBindData final : public CallTableFuncBindData {
+    TableCatalogEntry* tableEntry;
+    NodeTable* table;
+    ClientContext* context;
+
+    AnalyzeBindData(std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames,
+        TableCatalogEntry* tableEntry, NodeTable* table, ClientContext* context)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          tableEntry{tableEntry}, table{table}, context{context} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(LogicalType::copy(columnTypes), columnNames,
+            tableEntry, table, context);
+    }
+};
+
+// Collects the statistics of a single property. The NDV is estimated with a HyperLogLog sketch and
+// the histogram is built from a uniform reservoir sample of the non-null values.
+class PropertyStatisticsCollector {
+    static constexpr uint64_t SAMPLE_SIZE = 4096;
+
+public:
+    explicit PropertyStatisticsCollector(const LogicalType& type)
+        : type{type},
+          collectHistogram{PropertyStatistics::supportsHistogram(type.getLogicalTypeID())},
+          canHash{!LogicalTypeUtils::isNested(type)}, numNulls{0}, numValues{0},
+          randomEngine{0 /*seed*/, 0 /*stream*/} {}
+
+    void collect(const ValueVector& vector) {
+        auto& selVector = vector.state->getSelVector();
+        for (auto i = 0u; i < selVector.getSelSize(); i++) {
+            const auto pos = selVector[i];
+            if (vector.isNull(pos)) {
+                numNulls++;
+                continue;
+            }
+            numValues++;
+            TypeUtils::visit(
+                type.getPhysicalType(),
+                [&]<HashableNonNestedTypes T>(T) {
+                    if (!canHash) {
+                        return;
+                    }
+                    hash_t hash = 0;
+                    Hash::operation(vector.getValue<T>(pos), hash);
+                    sketch.add(hash);
+                    if constexpr (std::integral<T> || std::floating_point<T>) {
+                        if (collectHistogram) {
+                            sampleValue((double)vector.getValue<T>(pos));
+                        }
+                    }
+                },
+                [](auto) {});
+        }
+    }
+
+    PropertyStatistics finalize() {
+        PropertyStatistics result;
+        const auto numTuples = numNulls + numValues;
+        result.nullFraction = numTuples == 0 ? 0 : (double)numNulls / numTuples;
+        // The NDV of nested values is unknown.
+        result.numDistinct = canHash ? std::min<uint64_t>(sketch.estimate(), numValues) : 0;
+        if (collectHistogram && !sample.empty()) {
+            std::sort(sample.begin(), sample.end());
+            const auto numBuckets = std::min<uint64_t>(PropertyStatistics::NUM_HISTOGRAM_BUCKETS,
+                sample.size());
+            for (auto i = 0u; i <= numBuckets; i++) {
+                const auto idx = std::min<uint64_t>(i * sample.size() / numBuckets,
+                    sample.size() - 1);
+                result.histogramBounds.push_back(sample[idx]);
+            }
+        }
+        return result;
+    }
+
+private:
+    void sampleValue(double value) {
+        if (sample.size() < SAMPLE_SIZE) {
+            sample.push_back(value);
+            return;
+        }
+        // Reservoir sampling: keep the value with probability SAMPLE_SIZE / numValues.
+        const auto idx = (((uint64_t)randomEngine.nextRandomInteger() << 32) |
+                             randomEngine.nextRandomInteger()) %
+                         numValues;
+        if (idx < SAMPLE_SIZE) {
+            sample[idx] = value;
+        }
+    }
+
+private:
+    const LogicalType& type;
+    bool collectHistogram;
+    bool canHash;
+    uint64_t numNulls;
+    uint64_t numValues;
+    HyperLogLog sketch;
+    std::vector<double> sample;
+    RandomEngine randomEngine;
+};
+
+static std::shared_ptr<TableStatistics> collectStatistics(const AnalyzeBindData& bindData) {
+    auto transaction = bindData.context->getTx();
+    auto memoryManager = bindData.context->getMemoryManager();
+    auto& table = *bindData.table;
+    auto& properties = bindData.tableEntry->getProperties();
+    std::vector<column_id_t> columnIDs;
+    std::vector<Column*> columns;
+    DataChunk dataChunk(properties.size() + 1);
+    dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID(), memoryManager));
+    std::vector<PropertyStatisticsCollector> collectors;
+    for (auto i = 0u; i < properties.size(); i++) {
+        auto& property = properties[i];
+        const auto columnID = bindData.tableEntry->getColumnID(property.getName());
+        columnIDs.push_back(columnID);
+        columns.push_back(&table.getColumn(columnID));
+        dataChunk.insert(i + 1,
+            std::make_shared<ValueVector>(property.getType().copy(), memoryManager));
+        collectors.emplace_back(property.getType());
+    }
+    auto scanState =
+        NodeTableScanState(table.getTableID(), std::move(columnIDs), std::move(columns));
+    scanState.nodeIDVector = &dataChunk.getValueVectorMutable(0);
+    for (auto i = 0u; i < properties.size(); i++) {
+        scanState.outputVectors.push_back(&dataChunk.getValueVectorMutable(i + 1));
+    }
+    scanState.rowIdxVector->state = dataChunk.state;
+    scanState.outState = dataChunk.state.get();
+    uint64_t numRows = 0;
+    // Only committed data is analyzed.
+    for (auto groupIdx = 0u; groupIdx < table.getNumCommittedNodeGroups(); groupIdx++) {
+        scanState.source = TableScanSource::COMMITTED;
+        scanState.nodeGroupIdx = groupIdx;
+        table.initScanState(transaction, scanState);
+        while (table.scan(transaction, scanState)) {
+            numRows += dataChunk.state->getSelVector().getSelSize();
+            for (auto i = 0u; i < properties.size(); i++) {
+                collectors[i].collect(*scanState.outputVectors[i]);
+            }
+        }
+    }
+    auto statistics = std::make_shared<TableStatistics>(numRows);
+    for (auto i = 0u; i < properties.size(); i++) {
+        statistics->setPropertyStatistics(properties[i].getName(), collectors[i].finalize());
+    }
+    return statistics;
+}
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    auto statistics = collectStatistics(*bindData);
+    bindData->tableEntry->setStatistics(statistics);
+    auto& properties = bindData->tableEntry->getProperties();
+    KU_ASSERT(properties.size() <= DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < properties.size(); i++) {
+        auto name = properties[i].getName();
+        auto& propertyStatistics = statistics->getPropertyStatistics(name);
+        dataChunk.getValueVectorMutable(0).setValue(i, name);
+        dataChunk.getValueVectorMutable(1).setValue(i, propertyStatistics.nullFraction);
+        dataChunk.getValueVectorMutable(2).setValue<int64_t>(i, propertyStatistics.numDistinct);
+        if (propertyStatistics.hasHistogram()) {
+            dataChunk.getValueVectorMutable(3).setValue(i,
+                propertyStatistics.histogramBounds.front());
+            dataChunk.getValueVectorMutable(4).setValue(i,
+                propertyStatistics.histogramBounds.back());
+        } else {
+            dataChunk.getValueVectorMutable(3).setNull(i, true);
+            dataChunk.getValueVectorMutable(4).setNull(i, true);
+        }
+    }
+    return properties.size();
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    std::vector<std::string> columnNames = {"property_name", "null_fraction", "num_distinct",
+        "min", "max"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    auto tableName = input->inputs[0].getValue<std::string>();
+    auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    auto tableID = catalog->getTableID(context->getTx(), tableName);
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{"Cannot analyze " + tableName + ". Only node tables are supported."};
+    }
+    auto table = context->getStorageManager()->getTable(tableID)->ptrCast<NodeTable>();
+    return std::make_unique<AnalyzeBindData>(std::move(columnTypes), std::move(columnNames),
+        tableEntry, table, context);
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,76 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "storage/storage_manager.h"
+#include "storage/store/rel_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct SortAdjacencyListsBindData final : public CallTableFuncBindData {
+    RelTableCatalogEntry* tableEntry;
+
+    SortAdjacencyListsBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, RelTableCatalogEntry* tableEntry)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          tableEntry{tableEntry} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SortAdjacencyListsBindData>(LogicalType::copy(columnTypes),
+            columnNames, tableEntry);
+    }
+};
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<SortAdjacencyListsBindData>();
+    bindData->tableEntry->setSortedAdjacencyLists();
+    output.dataChunk.getValueVectorMutable(0).setValue(0, bindData->tableEntry->getName());
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    std::vector<std::string> columnNames = {"table_name"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.emplace_back(LogicalType::STRING());
+    auto tableName = input->inputs[0].getValue<std::string>();
+    auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    auto tableID = catalog->getTableID(context->getTx(), tableName);
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
+    if (tableEntry->getTableType() != TableType::REL) {
+        throw BinderException{
+            "Cannot sort adjacency lists of " + tableName + ". It is not a rel table."};
+    }
+    // Lists that are already on disk are not rewritten, so the order can only be enabled before
+    // the first rel is inserted.
+    if (context->getStorageManager()->getTable(tableID)->getNumRows() != 0) {
+        throw BinderException{
+            "Cannot sort adjacency lists of " + tableName + ". The table must be empty."};
+    }
+    return std::make_unique<SortAdjacencyListsBindData>(std::move(columnTypes),
+        std::move(columnNames), tableEntry->ptrCast<RelTableCatalogEntry>());
+}
+
+function_set SortAdjacencyListsFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "function/hash/vector_hash_functions.h"
 
+#include <array>
+
 #include "common/type_utils.h"
 #include "function/hash/hash_functions.h"
 #include "function/scalar_function.h"
@@ -199,6 +201,51 @@ static void computeStructVecHash(const ValueVector& operand, const SelectionVect
     }
 }
 
+// Strings scanned from the same dictionary entry share their overflow data (see
+// DictionaryColumn::scan). The hash of a long string is therefore cached by its data pointer, so
+// each distinct dictionary entry in a vector is hashed once.
+class StringHashCache {
+public:
+    hash_t getHash(const ku_string_t& value) {
+        if (ku_string_t::isShortString(value.len)) {
+            hash_t result = 0;
+            Hash::operation(value, result);
+            return result;
+        }
+        auto& entry = entries[(value.overflowPtr >> 3) % NUM_ENTRIES];
+        if (entry.overflowPtr != value.overflowPtr || entry.len != value.len) {
+            entry.overflowPtr = value.overflowPtr;
+            entry.len = value.len;
+            Hash::operation(value, entry.hash);
+        }
+        return entry.hash;
+    }
+
+private:
+    struct Entry {
+        uint64_t overflowPtr = 0;
+        uint32_t len = 0;
+        hash_t hash = 0;
+    };
+    static constexpr uint64_t NUM_ENTRIES = 64;
+    std::array<Entry, NUM_ENTRIES> entries;
+};
+
+static void computeStringHash(const ValueVector& operand, const SelectionVector& operandSelVec,
+    ValueVector& result, const SelectionVector& resultSelVec) {
+    StringHashCache cache;
+    auto resultValues = reinterpret_cast<hash_t*>(result.getData());
+    for (auto i = 0u; i < operandSelVec.getSelSize(); i++) {
+        auto operandPos = operandSelVec[i];
+        auto resultPos = resultSelVec[i];
+        if (operand.isNull(operandPos)) {
+            resultValues[resultPos] = NULL_HASH;
+        } else {
+            resultValues[resultPos] = cache.getHash(operand.getValue<ku_string_t>(operandPos));
+        }
+    }
+}
+
 void VectorHashFunction::computeHash(const ValueVector& operand,
     const SelectionVector& operandSelectVec, ValueVector& result,
     const SelectionVector& resultSelectVec) {
@@ -206,6 +253,9 @@ void VectorHashFunction::computeHash(const ValueVector& operand,
     KU_ASSERT(result.dataType.getLogicalTypeID() == LogicalType::HASH().getLogicalTypeID());
     TypeUtils::visit(
         operand.dataType.getPhysicalType(),
+        [&](ku_string_t) {
+            computeStringHash(operand, operandSelectVec, result, resultSelectVec);
+        },
         [&]<HashableNonNestedTypes T>(T) {
             UnaryHashFunctionExecutor::execute<T, hash_t>(operand, operandSelectVec, result,
                 resultSelectVec);
@@ -192,6 +192,19 @@ Graph::Iterator OnDiskGraph::scanFwd(nodeID_t nodeID, GraphScanState& state) {
     return Graph::Iterator(&onDiskScanState);
 }
 
+uint64_t OnDiskGraph::countFwd(nodeID_t nodeID, GraphScanState& state) {
+    auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
+    KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
+    auto& relTables = nodeTableIDToFwdRelTables.at(nodeID.tableID);
+    uint64_t result = 0;
+    for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
+        if (relTables.contains(tableID)) {
+            result += scanState.fwdIterator.count(nodeID.offset);
+        }
+    }
+    return result;
+}
+
 std::vector<nodeID_t> OnDiskGraph::scanFwdRandom(nodeID_t, GraphScanState&) {
     // auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
     // KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
@@ -225,6 +238,19 @@ Graph::Iterator OnDiskGraph::scanBwd(nodeID_t nodeID, GraphScanState& state) {
     return Graph::Iterator(&onDiskScanState);
 }
 
+uint64_t OnDiskGraph::countBwd(nodeID_t nodeID, GraphScanState& state) {
+    auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
+    KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
+    auto& relTables = nodeTableIDToBwdRelTables.at(nodeID.tableID);
+    uint64_t result = 0;
+    for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
+        if (relTables.contains(tableID)) {
+            result += scanState.bwdIterator.count(nodeID.offset);
+        }
+    }
+    return result;
+}
+
 std::vector<nodeID_t> OnDiskGraph::scanBwdRandom(nodeID_t, GraphScanState&) {
     // auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
     // KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
@@ -255,6 +281,10 @@ void OnDiskGraphScanState::InnerIterator::initScan() {
     relTable->initScanState(context->getTx(), *tableScanState);
 }
 
+uint64_t OnDiskGraphScanState::InnerIterator::count(offset_t boundNodeOffset) {
+    return relTable->countRels(context->getTx(), *tableScanState, boundNodeOffset);
+}
+
 bool OnDiskGraphScanStates::next() {
     while (iteratorIndex < scanStates.size()) {
         if (getInnerIterator().next()) {
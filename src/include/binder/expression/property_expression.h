@@ -51,6 +51,8 @@ public:
 
     // If this property exists for given table.
     bool hasProperty(common::table_id_t tableID) const;
+    // Tables on which this property exists.
+    std::vector<common::table_id_t> getTableIDs() const;
 
     bool isInternalID() const { return getPropertyName() == common::InternalKeyword::ID; }
     bool isIRI() const { return getPropertyName() == common::rdf::IRI; }
@@ -44,6 +44,11 @@ struct SubqueryGraph {
         return queryRelsSelector.count() == 1 && queryNodesSelector.count() == 0;
     }
 
+    bool isDisjoint(const SubqueryGraph& other) const {
+        return (queryNodesSelector & other.queryNodesSelector).none() &&
+               (queryRelsSelector & other.queryRelsSelector).none();
+    }
+
     bool containAllVariables(std::unordered_set<std::string>& variables) const;
 
     std::unordered_set<common::idx_t> getNodeNbrPositions() const;
@@ -411,6 +411,17 @@ KUZU_C_API void kuzu_connection_interrupt(kuzu_connection* connection);
  */
 KUZU_C_API kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection,
     uint64_t timeout_in_ms);
+/**
+ * @brief Sets whether the results of read-only queries are streamed while the query executes
+ * instead of being materialized first. A streamed result keeps its transaction open until it is
+ * fully consumed or destroyed. Executing another statement on the same connection buffers the
+ * rest of the result first.
+ * @param connection The connection instance to set the option for.
+ * @param stream_results Whether to stream query results.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_set_stream_results(kuzu_connection* connection,
+    bool stream_results);
 
 // PreparedStatement
 /**
@@ -666,6 +677,8 @@ KUZU_C_API kuzu_state kuzu_query_result_get_query_summary(kuzu_query_result* que
     kuzu_query_summary* out_query_summary);
 /**
  * @brief Returns true if we have not consumed all tuples in the query result, false otherwise.
+ * A streamed query that fails while its result is consumed returns false and is reported by
+ * kuzu_query_result_is_success.
  * @param query_result The query result instance to check.
  */
 KUZU_C_API bool kuzu_query_result_has_next(kuzu_query_result* query_result);
@@ -1505,6 +1518,12 @@ KUZU_C_API void kuzu_query_summary_destroy(kuzu_query_summary* query_summary);
  * @param query_summary The query summary to get compilation time.
  */
 KUZU_C_API double kuzu_query_summary_get_compiling_time(kuzu_query_summary* query_summary);
+/**
+ * @brief Returns the planning time of the given query summary in milliseconds. The planning time
+ * includes join order enumeration and optimization and is part of the compiling time.
+ * @param query_summary The query summary to get planning time.
+ */
+KUZU_C_API double kuzu_query_summary_get_planning_time(kuzu_query_summary* query_summary);
 /**
  * @brief Returns the execution time of the given query summary in milliseconds.
  * @param query_summary The query summary to get execution time.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_set.h"
 #include "common/cast.h"
@@ -54,6 +56,10 @@ public:
     Catalog(const std::string& directory, common::VirtualFileSystem* vfs);
     virtual ~Catalog() = default;
 
+    // The version is bumped on every schema change so that caches of objects derived from the
+    // catalog (e.g. parsed statements) can detect that they are stale.
+    uint64_t getVersion() const { return version.load(std::memory_order_acquire); }
+
     // ----------------------------- Table Schemas ----------------------------
     bool containsTable(const transaction::Transaction* transaction,
         const std::string& tableName) const;
@@ -158,6 +164,8 @@ private:
         common::FileVersionType versionType) const;
 
 private:
+    void incrementVersion() { version.fetch_add(1, std::memory_order_acq_rel); }
+
     // ----------------------------- Functions ----------------------------
     void registerBuiltInFunctions();
 
@@ -200,6 +208,7 @@ private:
     std::unique_ptr<CatalogSet> sequences;
     std::unique_ptr<CatalogSet> functions;
     std::unique_ptr<CatalogSet> types;
+    std::atomic<uint64_t> version = 0;
 };
 
 } // namespace catalog
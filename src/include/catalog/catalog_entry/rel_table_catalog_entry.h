@@ -13,12 +13,13 @@ class RelTableCatalogEntry final : public TableCatalogEntry {
 public:
     RelTableCatalogEntry()
         : srcMultiplicity{}, dstMultiplicity{}, srcTableID{common::INVALID_TABLE_ID},
-          dstTableID{common::INVALID_TABLE_ID} {};
+          dstTableID{common::INVALID_TABLE_ID}, sortedAdjacencyLists{false} {};
     RelTableCatalogEntry(CatalogSet* set, std::string name, common::RelMultiplicity srcMultiplicity,
         common::RelMultiplicity dstMultiplicity, common::table_id_t srcTableID,
         common::table_id_t dstTableID)
         : TableCatalogEntry{set, entryType_, std::move(name)}, srcMultiplicity{srcMultiplicity},
-          dstMultiplicity{dstMultiplicity}, srcTableID{srcTableID}, dstTableID{dstTableID} {
+          dstMultiplicity{dstMultiplicity}, srcTableID{srcTableID}, dstTableID{dstTableID},
+          sortedAdjacencyLists{false} {
         propertyCollection =
             PropertyDefinitionCollection{1}; // Skip NBR_NODE_ID column as the first one.
     }
@@ -31,6 +32,10 @@ public:
     common::RelMultiplicity getMultiplicity(common::RelDataDirection direction) const;
     common::table_id_t getBoundTableID(common::RelDataDirection relDirection) const;
     common::table_id_t getNbrTableID(common::RelDataDirection relDirection) const;
+    // If set, the CSR lists of the table are stored sorted by neighbour offset. Rels that are not
+    // checkpointed yet are scanned after the sorted lists.
+    bool hasSortedAdjacencyLists() const { return sortedAdjacencyLists; }
+    void setSortedAdjacencyLists() { sortedAdjacencyLists = true; }
 
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<RelTableCatalogEntry> deserialize(common::Deserializer& deserializer);
@@ -48,6 +53,7 @@ private:
     common::RelMultiplicity dstMultiplicity;
     common::table_id_t srcTableID;
     common::table_id_t dstTableID;
+    bool sortedAdjacencyLists;
 };
 
 } // namespace catalog
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <mutex>
 #include <vector>
 
 #include "binder/ddl/bound_alter_info.h"
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "catalog/property_definition_collection.h"
+#include "catalog/table_statistics.h"
 #include "common/enums/table_type.h"
 #include "function/table_functions.h"
 
@@ -46,6 +48,11 @@ public:
         alterInfo = std::make_unique<binder::BoundAlterInfo>(alterInfo_.copy());
     }
 
+    // Statistics are hints for the planner. They are set outside of transactions and persisted at
+    // the next checkpoint. Returns nullptr if the table hasn't been analyzed.
+    std::shared_ptr<const TableStatistics> getStatistics() const;
+    void setStatistics(std::shared_ptr<const TableStatistics> newStatistics);
+
     common::column_id_t getMaxColumnID() const;
     void vacuumColumnIDs(common::column_id_t nextColumnID);
     std::string propertiesToCypher() const;
@@ -80,6 +87,8 @@ protected:
     std::string comment;
     PropertyDefinitionCollection propertyCollection;
     std::unique_ptr<binder::BoundAlterInfo> alterInfo;
+    mutable std::mutex statisticsMtx;
+    std::shared_ptr<const TableStatistics> statistics;
 };
 
 struct TableCatalogEntryHasher {
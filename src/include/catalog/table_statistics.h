@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "common/case_insensitive_map.h"
+#include "common/copy_constructors.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace catalog {
+
+// Statistics of a single property, collected over the committed tuples of a table.
+struct PropertyStatistics {
+    static constexpr uint64_t NUM_HISTOGRAM_BUCKETS = 32;
+
+    double nullFraction = 0;
+    // Estimated number of distinct non-null values. 0 if unknown.
+    uint64_t numDistinct = 0;
+    // Equi-depth histogram over non-null values of numeric properties. Each bucket
+    // [histogramBounds[i], histogramBounds[i + 1]] holds the same number of values.
+    std::vector<double> histogramBounds;
+
+    bool hasHistogram() const { return histogramBounds.size() >= 2; }
+    static bool supportsHistogram(common::LogicalTypeID typeID);
+
+    // Fraction of tuples equal to a given value, assuming uniformly distributed distinct values.
+    // Requires numDistinct to be known.
+    double getEqualitySelectivity() const;
+    // Fraction of tuples with a value less than (or equal to, if inclusive) the given value.
+    double getLessThanSelectivity(double value, bool inclusive) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static PropertyStatistics deserialize(common::Deserializer& deserializer);
+};
+
+// Statistics of a table used by the cardinality estimator. They are collected by CALL
+// ANALYZE(table) and persisted with the catalog. Statistics are not updated with data changes,
+// so they describe the table at the time it was analyzed.
+class TableStatistics {
+public:
+    TableStatistics() : numRows{0} {}
+    explicit TableStatistics(uint64_t numRows) : numRows{numRows} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(TableStatistics);
+
+    uint64_t getNumRows() const { return numRows; }
+
+    bool containsProperty(const std::string& propertyName) const {
+        return propertyStatistics.contains(propertyName);
+    }
+    const PropertyStatistics& getPropertyStatistics(const std::string& propertyName) const {
+        return propertyStatistics.at(propertyName);
+    }
+    void setPropertyStatistics(const std::string& propertyName, PropertyStatistics statistics) {
+        propertyStatistics.insert_or_assign(propertyName, std::move(statistics));
+    }
+    void renameProperty(const std::string& propertyName, const std::string& newName);
+    void dropProperty(const std::string& propertyName) { propertyStatistics.erase(propertyName); }
+
+    void serialize(common::Serializer& serializer) const;
+    static std::unique_ptr<TableStatistics> deserialize(common::Deserializer& deserializer);
+
+private:
+    TableStatistics(const TableStatistics& other) = default;
+
+private:
+    uint64_t numRows;
+    common::case_insensitive_map_t<PropertyStatistics> propertyStatistics;
+};
+
+} // namespace catalog
+} // namespace kuzu
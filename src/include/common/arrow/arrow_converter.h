@@ -26,6 +26,10 @@ public:
         const std::vector<std::string>& columnNames);
     static void toArrowArray(main::QueryResult& queryResult, ArrowArray* out_array,
         std::int64_t chunkSize);
+    // Exports the remaining tuples of the query result as a stream of arrays of at most chunkSize
+    // tuples. The query result must outlive the stream.
+    static void toArrowArrayStream(main::QueryResult& queryResult, ArrowArrayStream* outStream,
+        std::int64_t chunkSize);
 
     static common::LogicalType fromArrowSchema(const ArrowSchema* schema);
     static void fromArrowArray(const ArrowSchema* schema, const ArrowArray* array,
@@ -55,6 +55,18 @@ private:
         std::int64_t capacity);
     static void appendValue(ArrowVector* vector, const LogicalType& type, Value* value);
 
+    // Columnar path: the result is scanned into value vectors whose buffers are copied into the
+    // arrow buffers in bulk instead of going through a flat tuple value by value.
+    bool canAppendVectors(const main::QueryResult& queryResult) const;
+    static bool canAppendVector(const LogicalType& type);
+    std::int64_t appendVectors(main::QueryResult& queryResult, std::int64_t chunkSize);
+    static void appendVector(ArrowVector* vector, const LogicalType& type,
+        const ValueVector& valueVector, std::int64_t numValues);
+    static void appendValidity(ArrowVector* vector, const ValueVector& valueVector,
+        std::int64_t numValues);
+    static void appendStringVector(ArrowVector* vector, const ValueVector& valueVector,
+        std::int64_t numValues);
+
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertStructVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertInternalIDVectorToArray(ArrowVector& vector, const LogicalType& type);
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+class MemoryBuffer;
+class MemoryManager;
+} // namespace storage
+
+namespace common {
+
+// Blocked bloom filter over hash values. Every hash sets NUM_BITS_PER_HASH bits of a single 64-bit
+// word, so a lookup touches one cache line. A filter that has not been sized yet (see reset)
+// contains every hash. The words are allocated through the memory manager. Not thread-safe for
+// insertion.
+class BloomFilter {
+public:
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    static constexpr uint64_t NUM_BITS_PER_HASH = 4;
+    // 32MB. Larger key sets get fewer bits per key, and so more false positives.
+    static constexpr uint64_t MAX_NUM_WORDS = (uint64_t)1 << 22;
+
+    BloomFilter();
+    ~BloomFilter();
+
+    // Sizes the filter for the given number of keys and clears it. If the memory for the filter
+    // cannot be reserved, the filter is left unsized and contains every hash.
+    void reset(storage::MemoryManager& memoryManager, uint64_t numKeys);
+
+    void insert(hash_t hash) { words[getWordIdx(hash)] |= getWordMask(hash); }
+    bool mayContain(hash_t hash) const {
+        if (words == nullptr) {
+            return true;
+        }
+        const auto mask = getWordMask(hash);
+        return (words[getWordIdx(hash)] & mask) == mask;
+    }
+
+private:
+    // Use the high half of the hash for the word and the low half for the bits within the word.
+    uint64_t getWordIdx(hash_t hash) const { return (hash >> 32) & wordIdxMask; }
+    static uint64_t getWordMask(hash_t hash) {
+        uint64_t mask = 0;
+        for (auto i = 0u; i < NUM_BITS_PER_HASH; i++) {
+            mask |= (uint64_t)1 << ((hash >> (i * 6)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    std::unique_ptr<storage::MemoryBuffer> buffer;
+    uint64_t* words = nullptr;
+    uint64_t wordIdxMask = 0;
+};
+
+} // namespace common
+} // namespace kuzu
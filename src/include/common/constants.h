@@ -201,6 +201,9 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Scan only the properties used by the predicates on a node and fetch its other properties
+    // after filtering if the estimated selectivity of the predicates is at most this value.
+    static constexpr double LATE_MATERIALIZATION_SELECTIVITY = 0.05;
 };
 
 struct OrderByConstants {
@@ -232,6 +235,12 @@ struct ExportCSVConstants {
     static constexpr const char* DEFAULT_NULL_STR = "";
     static constexpr bool DEFAULT_FORCE_QUOTE = false;
     static constexpr uint64_t DEFAULT_CSV_FLUSH_SIZE = 4096 * 8;
+    // Compressed output is flushed in larger blocks, each compressed independently.
+    static constexpr uint64_t DEFAULT_COMPRESSED_CSV_FLUSH_SIZE = 1024 * 1024;
+    static constexpr const char* PER_THREAD_OUTPUT_OPTION = "PER_THREAD_OUTPUT";
+    static constexpr const char* COMPRESSION_OPTION = "COMPRESSION";
+    static constexpr const char* GZIP_FILE_SUFFIX = ".gz";
+    static constexpr const char* ZSTD_FILE_SUFFIX = ".zst";
 };
 
 struct ImportDBConstants {
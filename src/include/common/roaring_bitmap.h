@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+
+// Set of the values of one 2^16 chunk of a RoaringBitmap, stored either as a sorted array of the
+// values (sparse) or as a plain bitmap (dense), whichever is smaller.
+class RoaringContainer {
+public:
+    static constexpr uint32_t NUM_VALUES = 1 << 16;
+    static constexpr uint32_t NUM_WORDS = NUM_VALUES / 64;
+    // A sparse container with more values would take more space than a dense one.
+    static constexpr uint32_t MAX_SPARSE_SIZE = 4096;
+    static constexpr int32_t NO_VALUE = -1;
+
+    bool isDense() const { return !words.empty(); }
+    uint32_t getCardinality() const { return cardinality; }
+    bool isEmpty() const { return cardinality == 0; }
+
+    void add(uint16_t value);
+    bool contains(uint16_t value) const;
+    // Returns true if any value in [start, end] is set.
+    bool containsAny(uint16_t start, uint16_t end) const;
+    // Returns the smallest set value that is >= value, or NO_VALUE if there is none.
+    int32_t getNextSetValue(uint32_t value) const;
+
+    void unionWith(const RoaringContainer& other);
+    void intersectWith(const RoaringContainer& other);
+
+private:
+    void toDense();
+    void toSparse();
+
+private:
+    std::vector<uint16_t> values;
+    std::vector<uint64_t> words;
+    uint32_t cardinality = 0;
+};
+
+// Compressed bitmap of offsets in the style of roaring bitmaps. Offsets are partitioned by their
+// high bits into chunks of 2^16 offsets, and only chunks holding at least one offset have a
+// container. Not thread-safe.
+class RoaringBitmap {
+public:
+    static constexpr uint64_t CHUNK_SIZE_LOG2 = 16;
+
+    void add(offset_t offset);
+    bool contains(offset_t offset) const;
+    // Returns true if any offset in [startOffset, endOffset] is set.
+    bool containsAny(offset_t startOffset, offset_t endOffset) const;
+    // Returns the smallest set offset that is >= offset, or INVALID_OFFSET if there is none.
+    offset_t getNextSetOffset(offset_t offset) const;
+
+    void unionWith(const RoaringBitmap& other);
+    void intersectWith(const RoaringBitmap& other);
+
+    uint64_t getCardinality() const;
+    bool isEmpty() const { return getCardinality() == 0; }
+
+private:
+    static uint64_t getChunkIdx(offset_t offset) { return offset >> CHUNK_SIZE_LOG2; }
+    static uint16_t getValueInChunk(offset_t offset) {
+        return offset & (RoaringContainer::NUM_VALUES - 1);
+    }
+
+private:
+    // Indexed by chunk idx. Empty chunks have no container.
+    std::vector<std::unique_ptr<RoaringContainer>> containers;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "function/function.h"
+
+namespace kuzu {
+namespace function {
+
+struct ApproxCountDistinctFunction {
+    static constexpr const char* name = "APPROX_COUNT_DISTINCT";
+
+    static function_set getFunctionSet();
+};
+
+} // namespace function
+} // namespace kuzu
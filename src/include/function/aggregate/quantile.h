@@ -0,0 +1,38 @@
+#pragma once
+
+#include "function/function.h"
+
+namespace kuzu {
+namespace function {
+
+// Exact continuous quantile, interpolating between the two closest values.
+struct QuantileContFunction {
+    static constexpr const char* name = "QUANTILE_CONT";
+
+    static function_set getFunctionSet();
+};
+
+// Exact discrete quantile, returning the first value whose cumulative fraction reaches the given
+// fraction.
+struct QuantileDiscFunction {
+    static constexpr const char* name = "QUANTILE_DISC";
+
+    static function_set getFunctionSet();
+};
+
+// Equivalent to QUANTILE_CONT(x, 0.5).
+struct MedianFunction {
+    static constexpr const char* name = "MEDIAN";
+
+    static function_set getFunctionSet();
+};
+
+// Continuous quantile estimated with a t-digest, which uses bounded memory per group.
+struct ApproxQuantileFunction {
+    static constexpr const char* name = "APPROX_QUANTILE";
+
+    static function_set getFunctionSet();
+};
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+
+#include "function/hash/hash_functions.h"
+
+namespace kuzu {
+namespace function {
+
+// HyperLogLog sketch (Flajolet et al.). The top NUM_REGISTERS_LOG2 bits of a hash select a
+// register, which keeps the maximum number of leading zeros + 1 seen in the remaining bits. The
+// registers are stored inline so that sketches built by different threads are merged by taking
+// the register-wise maximum. With 2^10 registers the standard error is about 3%.
+class HyperLogLog {
+public:
+    static constexpr uint64_t NUM_REGISTERS_LOG2 = 10;
+    static constexpr uint64_t NUM_REGISTERS = 1 << NUM_REGISTERS_LOG2;
+
+    HyperLogLog() : registers{} {}
+
+    void add(common::hash_t hash) {
+        // Re-mix the hash since some types (e.g. double) are hashed with few mixed high bits.
+        hash = murmurhash64(hash);
+        const auto idx = hash >> (64 - NUM_REGISTERS_LOG2);
+        const auto rank = (uint8_t)(std::countl_zero((hash << NUM_REGISTERS_LOG2) |
+                                                     ((uint64_t)1 << (NUM_REGISTERS_LOG2 - 1))) +
+                                    1);
+        registers[idx] = std::max(registers[idx], rank);
+    }
+
+    void merge(const HyperLogLog& other) {
+        for (auto i = 0u; i < NUM_REGISTERS; i++) {
+            registers[i] = std::max(registers[i], other.registers[i]);
+        }
+    }
+
+    int64_t estimate() const {
+        constexpr double m = NUM_REGISTERS;
+        constexpr double alpha = 0.7213 / (1 + 1.079 / m);
+        double sum = 0;
+        auto numZeroRegisters = 0u;
+        for (auto i = 0u; i < NUM_REGISTERS; i++) {
+            sum += std::ldexp(1.0, -registers[i]);
+            numZeroRegisters += registers[i] == 0;
+        }
+        auto result = alpha * m * m / sum;
+        // Small range correction: fall back to linear counting.
+        if (result <= 2.5 * m && numZeroRegisters > 0) {
+            result = m * std::log(m / numZeroRegisters);
+        }
+        return std::llround(result);
+    }
+
+private:
+    uint8_t registers[NUM_REGISTERS];
+};
+
+} // namespace function
+} // namespace kuzu
@@ -13,15 +13,7 @@ struct EndsWith {
             return;
         }
         auto lenDiff = left.len - right.len;
-        auto lData = left.getData();
-        auto rData = right.getData();
-        for (auto i = 0u; i < right.len; i++) {
-            if (rData[i] != lData[lenDiff + i]) {
-                result = 0;
-                return;
-            }
-        }
-        result = 1;
+        result = memcmp(left.getData() + lenDiff, right.getData(), right.len) == 0;
     }
 };
 
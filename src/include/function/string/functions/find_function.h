@@ -13,8 +13,11 @@ struct Find {
         int64_t& result) {
         if (right.len == 0) {
             result = 1;
-        } else if (right.len > left.len) {
+            return;
+        }
+        if (right.len > left.len) {
             result = 0;
+            return;
         }
         result = Find::find(left.getData(), left.len, right.getData(), right.len) + 1;
     }
@@ -31,6 +34,16 @@ private:
     static int64_t genericFind(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
         uint32_t needLen, uint32_t firstMatchCharOffset);
 
+    static int64_t scalarFind(const uint8_t* haystack, uint32_t haystackLen,
+        const uint8_t* needle, uint32_t needleLen);
+
+#if defined(__SSE2__)
+    // Compares the first and the last character of the needle against 16 consecutive positions of
+    // the haystack at a time, and only verifies the positions where both match.
+    static int64_t simdFind(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
+        uint32_t needleLen);
+#endif
+
     // Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
     // contain needle, it returns -1.
     static int64_t find(const uint8_t* haystack, uint32_t haystackLen, const uint8_t* needle,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "common/types/ku_string.h"
 
 namespace kuzu {
@@ -8,9 +10,22 @@ namespace function {
 struct StartsWith {
     static inline void operation(common::ku_string_t& left, common::ku_string_t& right,
         uint8_t& result) {
-        auto lStr = left.getAsString();
-        auto rStr = right.getAsString();
-        result = lStr.starts_with(rStr);
+        if (right.len > left.len) {
+            result = 0;
+            return;
+        }
+        // Both short and long strings keep their first characters inline, so most mismatches
+        // are found without reading the overflow data.
+        auto prefixLen = std::min<uint64_t>(right.len, common::ku_string_t::PREFIX_LENGTH);
+        if (memcmp(left.prefix, right.prefix, prefixLen) != 0) {
+            result = 0;
+            return;
+        }
+        if (right.len <= common::ku_string_t::PREFIX_LENGTH) {
+            result = 1;
+            return;
+        }
+        result = memcmp(left.getData(), right.getData(), right.len) == 0;
     }
 };
 
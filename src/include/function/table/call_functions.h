@@ -105,6 +105,18 @@ struct StorageInfoFunction final : CallFunction {
     static function_set getFunctionSet();
 };
 
+struct AnalyzeFunction final : CallFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
+struct SortAdjacencyListsFunction final : CallFunction {
+    static constexpr const char* name = "SORT_ADJACENCY_LISTS";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowAttachedDatabasesFunction final : CallFunction {
     static constexpr const char* name = "SHOW_ATTACHED_DATABASES";
 
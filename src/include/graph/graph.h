@@ -70,9 +70,9 @@ public:
             // Only needed for comparing to the end, so they are equal if and only if both are null
             return scanState == nullptr && other.scanState == nullptr;
         }
-        // Counts and consumes the iterator
+        // Counts and consumes the iterator. Use Graph::countFwd/countBwd instead to count without
+        // scanning neighbours.
         uint64_t count() {
-            // TODO(bmwinger): avoid scanning if all that's necessary is to count the results
             uint64_t result = 0;
             do {
                 result += scanState->getNbrNodes().size();
@@ -126,6 +126,10 @@ public:
     // Get dst nodeIDs for given src nodeID using forward adjList.
     virtual Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
 
+    // Get the number of dst nodes for given src nodeID using forward adjList. Only the degree of
+    // the node is read, neighbours are not scanned.
+    virtual uint64_t countFwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+
     // Scans multiple nodeIDs in random mode, which is optimized for small lookups and does minimal
     // caching of CSR headers.
     virtual std::vector<common::nodeID_t> scanFwdRandom(common::nodeID_t nodeID,
@@ -141,6 +145,8 @@ public:
 
     // Get dst nodeIDs for given src nodeID tables using backward adjList.
     virtual Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+    // Get the number of dst nodes for given src nodeID using backward adjList.
+    virtual uint64_t countBwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
     virtual std::vector<common::nodeID_t> scanBwdRandom(common::nodeID_t nodeID,
         GraphScanState& state) = 0;
 };
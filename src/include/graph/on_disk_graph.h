@@ -52,6 +52,7 @@ struct OnDiskGraphScanState {
 
         bool next();
         void initScan();
+        uint64_t count(common::offset_t boundNodeOffset);
 
     private:
         const common::SelectionVector& dstSelVector() const {
@@ -142,9 +143,11 @@ public:
         std::span<common::table_id_t> nodeTableIDs) override;
 
     Graph::Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    uint64_t countFwd(common::nodeID_t nodeID, GraphScanState& state) override;
     std::vector<common::nodeID_t> scanFwdRandom(common::nodeID_t nodeID,
         GraphScanState& state) override;
     Graph::Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    uint64_t countBwd(common::nodeID_t nodeID, GraphScanState& state) override;
     std::vector<common::nodeID_t> scanBwdRandom(common::nodeID_t nodeID,
         GraphScanState& state) override;
 
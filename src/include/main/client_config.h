@@ -21,6 +21,7 @@ struct ClientConfigDefault {
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 1;
     static constexpr bool DISABLE_MAP_KEY_CHECK = true;
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
+    static constexpr bool STREAM_RESULTS = false;
 };
 
 struct ClientConfig {
@@ -51,6 +52,8 @@ struct ClientConfig {
     // maximum number of cached warnings
     uint64_t warningLimit = ClientConfigDefault::WARNING_LIMIT;
     bool disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
+    // If streaming the results of read-only queries instead of materializing them.
+    bool streamResults = ClientConfigDefault::STREAM_RESULTS;
 };
 
 } // namespace main
@@ -36,6 +36,7 @@ struct DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+class StreamingExecution;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -51,6 +52,7 @@ struct ActiveQuery {
  */
 class KUZU_API ClientContext {
     friend class Connection;
+    friend class StreamingExecution;
     friend class binder::Binder;
     friend class binder::ExpressionBinder;
 
@@ -71,6 +73,7 @@ public:
     bool hasTimeout() const { return clientConfig.timeoutInMS != 0; }
     void setQueryTimeOut(uint64_t timeoutInMS);
     uint64_t getQueryTimeOut() const;
+    void setStreamResults(bool streamResults);
     void startTimer();
     uint64_t getTimeoutRemainingInMS() const;
     void resetActiveQuery() { activeQuery.reset(); }
@@ -120,7 +123,8 @@ public:
     void runQuery(std::string query);
 
     // only use for test framework
-    std::vector<std::shared_ptr<parser::Statement>> parseQuery(std::string_view query);
+    std::vector<std::shared_ptr<parser::Statement>> parseQuery(std::string_view query,
+        bool* statementCacheHit = nullptr);
 
     void setDefaultDatabase(AttachedKuzuDatabase* defaultDatabase_);
     bool hasDefaultDatabase();
@@ -141,6 +145,8 @@ private:
 
     std::unique_ptr<PreparedStatement> preparedStatementWithError(std::string_view errMsg);
 
+    void setStatementCacheSummary(PreparedSummary& summary, bool statementCacheHit) const;
+
     // when we do prepare, we will start a transaction for the query
     // when we execute after prepare in a same context, we set requireNewTx to false and will not
     // commit the transaction in prepare when we only prepare a query statement, we set requireNewTx
@@ -165,7 +171,14 @@ private:
         const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams);
 
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
-        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt);
+        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt,
+        bool allowStreaming = false);
+
+    bool canStreamResult(PreparedStatement* preparedStatement,
+        processor::PhysicalPlan* physicalPlan) const;
+    // A streamed result keeps its transaction open, so its remaining chunks are buffered and its
+    // transaction is ended before the next statement runs on this connection.
+    void finishActiveStreamNoLock();
 
     bool canExecuteWriteQuery();
 
@@ -193,6 +206,8 @@ private:
     std::unique_ptr<common::ProgressBar> progressBar;
     // Warning information
     processor::WarningContext warningContext;
+    // Execution of the last streamed query result, if it is still alive.
+    std::weak_ptr<StreamingExecution> activeStream;
     std::mutex mtx;
 };
 
@@ -88,6 +88,14 @@ public:
      */
     KUZU_API void setQueryTimeOut(uint64_t timeoutInMS);
 
+    /**
+     * @brief sets whether the results of read-only queries are streamed to the caller while the
+     * query executes instead of being materialized first. A streamed result keeps its transaction
+     * open until it is fully consumed or destroyed. Executing another statement on the same
+     * connection buffers the rest of the result first.
+     */
+    KUZU_API void setStreamResults(bool streamResults);
+
     // Note: this function throws exception if creating scalar function fails.
     template<typename TR, typename... Args>
     void createScalarFunction(std::string name, TR (*udfFunc)(Args...)) {
@@ -35,6 +35,7 @@ class StorageExtension;
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
+class StatementCache;
 class ClientContext;
 
 /**
@@ -148,6 +149,7 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
+    std::unique_ptr<StatementCache> statementCache;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
     QueryIDGenerator queryIDGenerator;
 };
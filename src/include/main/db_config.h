@@ -62,6 +62,7 @@ struct DBConfig {
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
     std::optional<std::string> spillToDiskTmpFile;
+    double relDeltaMergeRatio;
 
     explicit DBConfig(const SystemConfig& systemConfig);
 
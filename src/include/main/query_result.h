@@ -10,7 +10,13 @@
 #include "query_summary.h"
 
 namespace kuzu {
+namespace common {
+class ArrowRowBatch;
+class ValueVector;
+} // namespace common
+
 namespace main {
+class StreamingExecution;
 
 /**
  * @brief QueryResult stores the result of a query execution.
@@ -18,6 +24,7 @@ namespace main {
 class QueryResult {
     friend class Connection;
     friend class ClientContext;
+    friend class common::ArrowRowBatch;
     class QueryResultIterator {
     private:
         QueryResult* currentResult;
@@ -72,7 +79,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streamed result, this waits for the query to
+     * finish and buffers the remaining tuples.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,11 +112,15 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. A streamed result can only be reset before any of
+     * its chunks has been fully consumed.
      */
     KUZU_API void resetIterator();
 
-    processor::FactorizedTable* getTable() { return factorizedTable.get(); }
+    processor::FactorizedTable* getTable() {
+        fetchRemainingChunks();
+        return factorizedTable.get();
+    }
 
     /**
      * @brief Returns the arrow schema of the query result.
@@ -132,24 +144,58 @@ public:
      */
     KUZU_API std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize);
 
+    /**
+     * @brief Returns the remaining tuples of the query result as an arrow array stream.
+     * @param chunkSize maximum number of tuples in each array of the stream.
+     * @return An arrow C stream producing arrays in the same format as getNextArrowChunk.
+     *
+     * The query result must outlive the stream. It is the caller's responsibility to call the
+     * release function of the stream.
+     */
+    KUZU_API std::unique_ptr<ArrowArrayStream> getArrowArrayStream(int64_t chunkSize);
+
 private:
     void setColumnHeader(std::vector<std::string> columnNames,
         std::vector<common::LogicalType> columnTypes);
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_);
     void validateQuerySucceed() const;
 
+    // Pulls the next chunk of a streamed result, marking the result as failed on errors.
+    std::unique_ptr<processor::FactorizedTable> pullChunk() const;
+    // Replaces the current chunk of a streamed result with the next one. Returns false once the
+    // stream is exhausted.
+    bool fetchNextChunk() const;
+    // Appends all remaining chunks of a streamed result to the current one.
+    void fetchRemainingChunks() const;
+    void onStreamExhausted() const;
+
+    bool hasUnflatColumns() const;
+    // Scans up to maxNumTuples of the next tuples into the given vectors, bypassing the flat
+    // tuple. Only valid if the result has no unflat columns. Returns 0 once the result is
+    // exhausted.
+    uint64_t scanNextFlatTuples(std::vector<common::ValueVector*>& vectors, uint64_t maxNumTuples);
+    storage::MemoryManager* getMemoryManager() const;
+
 private:
     // execution status
-    bool success = true;
-    std::string errMsg;
+    // A streamed result may fail while it is being iterated.
+    mutable bool success = true;
+    mutable std::string errMsg;
 
     // header information
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnDataTypes;
     // data
-    std::shared_ptr<processor::FactorizedTable> factorizedTable;
-    std::unique_ptr<processor::FlatTupleIterator> iterator;
+    // Both are replaced chunk by chunk while iterating a streamed result.
+    mutable std::shared_ptr<processor::FactorizedTable> factorizedTable;
+    mutable std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    std::vector<common::Value*> valuesToCollect;
+
+    // streaming
+    std::shared_ptr<StreamingExecution> streamingExecution;
+    mutable bool streamExhausted = false;
+    mutable uint64_t numTuplesInConsumedChunks = 0;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
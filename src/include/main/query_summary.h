@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "common/api.h"
 #include "kuzu_fwd.h"
 
@@ -11,7 +13,11 @@ namespace main {
  */
 struct PreparedSummary { // NOLINT(*-pro-type-member-init)
     double compilingTime = 0;
+    double planningTime = 0;
     common::StatementType statementType;
+    bool statementCacheHit = false;
+    uint64_t statementCacheNumHits = 0;
+    uint64_t statementCacheNumMisses = 0;
 };
 
 /**
@@ -19,6 +25,7 @@ struct PreparedSummary { // NOLINT(*-pro-type-member-init)
  */
 class QuerySummary {
     friend class ClientContext;
+    friend class QueryResult;
     friend class benchmark::Benchmark;
 
 public:
@@ -26,10 +33,26 @@ public:
      * @return query compiling time in milliseconds.
      */
     KUZU_API double getCompilingTime() const;
+    /**
+     * @return query planning and optimizing time in milliseconds. It is part of the compiling time.
+     */
+    KUZU_API double getPlanningTime() const;
     /**
      * @return query execution time in milliseconds.
      */
     KUZU_API double getExecutionTime() const;
+    /**
+     * @return true if parsing was skipped because the query was found in the statement cache.
+     */
+    KUZU_API bool isStatementCacheHit() const;
+    /**
+     * @return number of statement cache hits of the database when the query was compiled.
+     */
+    KUZU_API uint64_t getNumHits() const;
+    /**
+     * @return number of statement cache misses of the database when the query was compiled.
+     */
+    KUZU_API uint64_t getNumMisses() const;
 
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
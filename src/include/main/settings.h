@@ -120,6 +120,18 @@ struct EnableZoneMapSetting {
     }
 };
 
+struct StreamResultsSetting {
+    static constexpr auto name = "stream_results";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->streamResults = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->streamResults);
+    }
+};
+
 struct EnableGDSSetting {
     static constexpr auto name = "enable_gds";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -235,6 +247,18 @@ struct ForceCheckpointClosingDBSetting {
     }
 };
 
+struct RelDeltaMergeRatioSetting {
+    static constexpr auto name = "rel_delta_merge_ratio";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getDBConfigUnsafe()->relDeltaMergeRatio = parameter.getValue<double>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->relDeltaMergeRatio);
+    }
+};
+
 struct SpillToDiskFileSetting {
     static constexpr auto name = "spill_to_disk_tmp_file";
     static constexpr auto inputType = common::LogicalTypeID::STRING;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "parser/statement.h"
+
+namespace kuzu {
+namespace main {
+
+// Database-wide LRU cache of parsed statements keyed by normalized query text. Parsing with ANTLR
+// dominates the compiling time of short, frequently repeated queries, so a hit skips it entirely.
+// Parsed statements are immutable once produced and are shared across connections. Each entry
+// records the catalog version it was parsed under because parsing may resolve user defined types;
+// an entry parsed under an older version is treated as a miss and replaced.
+// Bound and planned statements are not cached: parameter values are copied into bound expressions
+// and some functions are folded at bind time, so plans cannot be reused across executions until
+// binding keeps parameters symbolic. Caching plans is left as follow-up work.
+class StatementCache {
+    using statements_t = std::vector<std::shared_ptr<parser::Statement>>;
+
+public:
+    static constexpr uint64_t DEFAULT_CAPACITY = 256;
+
+    explicit StatementCache(uint64_t capacity = DEFAULT_CAPACITY) : capacity{capacity} {}
+
+    // Collapses runs of whitespace outside of string literals, escaped identifiers and comments
+    // into a single space and trims both ends, so that queries differing only in formatting share
+    // an entry.
+    static std::string normalize(std::string_view query);
+
+    // Returns an empty vector on a miss.
+    statements_t lookup(const std::string& key, uint64_t catalogVersion);
+    void insert(std::string key, statements_t statements, uint64_t catalogVersion);
+    void clear();
+
+    uint64_t getNumHits() const { return numHits.load(std::memory_order_relaxed); }
+    uint64_t getNumMisses() const { return numMisses.load(std::memory_order_relaxed); }
+    uint64_t size() const;
+
+private:
+    struct Entry {
+        std::string key;
+        statements_t statements;
+        uint64_t catalogVersion;
+    };
+
+    uint64_t capacity;
+    mutable std::mutex mtx;
+    // Most recently used entries are at the front.
+    std::list<Entry> entries;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+    std::atomic<uint64_t> numHits = 0;
+    std::atomic<uint64_t> numMisses = 0;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "common/metric.h"
+#include "common/profiler.h"
+#include "processor/execution_context.h"
+#include "processor/physical_plan.h"
+#include "processor/result/result_chunk_queue.h"
+
+namespace kuzu {
+namespace processor {
+class QueryProcessor;
+} // namespace processor
+
+namespace main {
+class ClientContext;
+
+// Executes the physical plan of a streamed query on a background thread while the query result
+// pulls chunks from the result collector through a bounded queue. The transaction of the query
+// stays open until the stream is finished: when the result is fully consumed or destroyed, or when
+// another statement is executed on the same connection, in which case the remaining chunks are
+// buffered first so the result can still be read.
+class StreamingExecution {
+public:
+    StreamingExecution(ClientContext* clientContext, processor::QueryProcessor* queryProcessor,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        std::shared_ptr<processor::ResultChunkQueue> chunkQueue);
+    ~StreamingExecution();
+
+    void start();
+    // Blocks until the next chunk of the result is available. Returns nullptr once the result is
+    // exhausted. Errors raised during execution are rethrown here.
+    std::unique_ptr<processor::FactorizedTable> getNextChunk();
+    // Waits for the execution to complete, buffering the remaining chunks, and then finishes.
+    // Must be called with the client context lock held.
+    void bufferRemainingChunks();
+    // Stops the execution if the result is not exhausted yet and ends the transaction of the
+    // query under the client context lock. Calling finish more than once has no effect.
+    void finish();
+
+    double getExecutionTime() const { return executingTimer.getElapsedTimeMS(); }
+
+private:
+    void finishNoLock();
+
+private:
+    ClientContext* clientContext;
+    processor::QueryProcessor* queryProcessor;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    std::shared_ptr<processor::ResultChunkQueue> chunkQueue;
+    common::TimeMetric executingTimer;
+    std::thread producer;
+    std::mutex mtx;
+    std::deque<std::unique_ptr<processor::FactorizedTable>> bufferedChunks;
+    std::exception_ptr bufferingError = nullptr;
+    bool finished = false;
+    bool closedEarly = false;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -19,9 +19,13 @@ private:
 
     bool tryProbeToBuildHJSIP(planner::LogicalOperator* op);
     bool tryBuildToProbeHJSIP(planner::LogicalOperator* op);
+    bool tryBloomFilterHJSIP(planner::LogicalOperator* op);
 
     void visitIntersect(planner::LogicalOperator* op) override;
 
+    bool tryProbeToBuildIntersectSIP(planner::LogicalOperator* op);
+    bool tryBloomFilterIntersectSIP(planner::LogicalOperator* op);
+
     void visitPathPropertyProbe(planner::LogicalOperator* op) override;
 
     std::shared_ptr<planner::LogicalOperator> tryApplySemiMask(
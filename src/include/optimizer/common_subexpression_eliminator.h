@@ -0,0 +1,25 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// Evaluate each expression shared by a chain of filters and a projection on top of it only once.
+// E.g. for MATCH (a) WHERE f(a.x) > 0.5 RETURN f(a.x), f(a.x) is computed by a projection
+// inserted below the filter. Its result is then in scope and both the filter and the projection
+// read it through a reference evaluator instead of recomputing it. Operators in such a chain share
+// the same input scope, so a shared expression is placed right below the lowest operator using it.
+class CommonSubexpressionEliminator : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void eliminate(const std::vector<planner::LogicalOperator*>& chain);
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer answers COUNT aggregates over the rels of each bound node, e.g.
+// MATCH (a)-[:Follows]->(b) RETURN a, COUNT(b) or COUNT { MATCH (a)-[:Follows]->() }, from the
+// CSR header (i.e. node degrees) instead of scanning adjacency lists. We search for pattern
+// EXTEND -> (PROJECTION) -> AGGREGATE
+// where the aggregate groups by keys of the bound node and the extend has no rel or nbr predicates,
+// and rewrite it as COUNT_REL_TABLE -> PROJECTION.
+class CountRelTableOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitAggregateReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
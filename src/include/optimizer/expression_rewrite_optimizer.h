@@ -0,0 +1,55 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+namespace optimizer {
+
+// Rule based simplification of filter predicates and projected expressions.
+// - Constant folding. Parameters are treated as constants because a prepared statement is re-bound
+//   and re-planned with its parameter values before each execution.
+// - Boolean simplification, e.g. x AND true -> x, NOT NOT x -> x.
+// - x = a OR x = b -> list_contains([a, b], x).
+// - Cast elimination in integer comparisons, e.g. CAST(x AS INT64) = 5 -> x = CAST(5 AS INT32)
+//   if x is an INT32, so that the comparison runs on the original column and can be pushed into
+//   scans.
+// Expressions are rewritten in place below the root, and a folded expression keeps the unique
+// name of the expression it replaces, so operators that refer to an expression by its unique name
+// are not affected. Expressions that are already computed in the input schema are not rewritten.
+class ExpressionRewriteOptimizer : public LogicalOperatorVisitor {
+public:
+    explicit ExpressionRewriteOptimizer(main::ClientContext* context) : context{context} {}
+
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+    std::shared_ptr<planner::LogicalOperator> visitFilterReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+    std::shared_ptr<planner::LogicalOperator> visitProjectionReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+
+    std::shared_ptr<binder::Expression> rewriteExpression(
+        const std::shared_ptr<binder::Expression>& expression, const planner::Schema& schema);
+    void rewriteChildren(binder::Expression& expression, const planner::Schema& schema);
+    std::shared_ptr<binder::Expression> foldExpression(
+        const std::shared_ptr<binder::Expression>& expression);
+    std::shared_ptr<binder::Expression> simplifyBoolean(
+        const std::shared_ptr<binder::Expression>& expression);
+    std::shared_ptr<binder::Expression> rewriteDisjunctionToIn(
+        const std::shared_ptr<binder::Expression>& expression);
+    std::shared_ptr<binder::Expression> eliminateCastInComparison(
+        const std::shared_ptr<binder::Expression>& expression);
+
+private:
+    main::ClientContext* context;
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
+
 #include "binder/query/query_graph.h"
+#include "catalog/table_statistics.h"
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
@@ -33,6 +36,9 @@ public:
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
     uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    // Estimated fraction of the tuples of childPlan that pass all predicates.
+    double estimateSelectivity(const LogicalPlan& childPlan,
+        const binder::expression_vector& predicates);
 
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode);
@@ -48,6 +54,14 @@ private:
 
     uint64_t getNumRels(const std::vector<common::table_id_t>& tableIDs);
 
+    // Selectivity of a predicate based on column statistics, falling back to PlannerKnobs if the
+    // referenced properties have no statistics.
+    double getSelectivity(const binder::Expression& predicate);
+    double getComparisonSelectivity(const binder::Expression& predicate);
+    // Statistics of a property that exists on a single analyzed table.
+    std::optional<catalog::PropertyStatistics> getPropertyStatistics(
+        const binder::Expression& expression);
+
 private:
     main::ClientContext* context;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
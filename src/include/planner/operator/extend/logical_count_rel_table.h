@@ -0,0 +1,46 @@
+#pragma once
+
+#include "binder/expression/rel_expression.h"
+#include "common/enums/extend_direction.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Computes the number of rels of each bound node in a single rel table from the CSR header,
+// without scanning neighbours. Bound nodes without rels are discarded. This replaces an extend
+// followed by a COUNT aggregate grouped by the bound node.
+class LogicalCountRelTable final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::COUNT_REL_TABLE;
+
+public:
+    LogicalCountRelTable(std::shared_ptr<binder::NodeExpression> boundNode,
+        std::shared_ptr<binder::RelExpression> rel, common::ExtendDirection direction,
+        std::shared_ptr<binder::Expression> countExpr, std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, boundNode{std::move(boundNode)},
+          rel{std::move(rel)}, direction{direction}, countExpr{std::move(countExpr)} {}
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override;
+
+    std::shared_ptr<binder::NodeExpression> getBoundNode() const { return boundNode; }
+    std::shared_ptr<binder::RelExpression> getRel() const { return rel; }
+    common::ExtendDirection getDirection() const { return direction; }
+    std::shared_ptr<binder::Expression> getCountExpr() const { return countExpr; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalCountRelTable>(boundNode, rel, direction, countExpr,
+            children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::NodeExpression> boundNode;
+    std::shared_ptr<binder::RelExpression> rel;
+    common::ExtendDirection direction;
+    std::shared_ptr<binder::Expression> countExpr;
+};
+
+} // namespace planner
+} // namespace kuzu
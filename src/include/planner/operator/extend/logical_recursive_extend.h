@@ -27,15 +27,28 @@ public:
     void setJoinType(RecursiveJoinType joinType_) { joinType = joinType_; }
     RecursiveJoinType getJoinType() const { return joinType; }
     std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
+    // The reverse recursive child extends from the nbr node towards the bound node. It is only set
+    // for shortest paths computed by bidirectional BFS.
+    void setReverseRecursiveChild(std::shared_ptr<LogicalOperator> child) {
+        reverseRecursiveChild = std::move(child);
+    }
+    std::shared_ptr<LogicalOperator> getReverseRecursiveChild() const {
+        return reverseRecursiveChild;
+    }
 
     std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
+        auto op = std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
             extendFromSource_, joinType, children[0]->copy(), recursiveChild->copy());
+        if (reverseRecursiveChild != nullptr) {
+            op->reverseRecursiveChild = reverseRecursiveChild->copy();
+        }
+        return op;
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    std::shared_ptr<LogicalOperator> reverseRecursiveChild;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
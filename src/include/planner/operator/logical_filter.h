@@ -21,6 +21,9 @@ public:
     inline std::string getExpressionsForPrinting() const override { return expression->toString(); }
 
     inline std::shared_ptr<binder::Expression> getPredicate() const { return expression; }
+    void setPredicate(std::shared_ptr<binder::Expression> predicate) {
+        expression = std::move(predicate);
+    }
 
     f_group_pos getGroupPosToSelect() const;
 
@@ -12,8 +12,10 @@ enum class LogicalOperatorType : uint8_t {
     AGGREGATE,
     ALTER,
     ATTACH_DATABASE,
+    BLOOM_FILTER_PROBE,
     COPY_FROM,
     COPY_TO,
+    COUNT_REL_TABLE,
     CREATE_MACRO,
     CREATE_SEQUENCE,
     CREATE_TABLE,
@@ -30,6 +32,7 @@ enum class LogicalOperatorType : uint8_t {
     EXTEND,
     EXTENSION,
     EXPORT_DATABASE,
+    FETCH_NODE_PROPERTY,
     FILTER,
     FLATTEN,
     GDS_CALL,
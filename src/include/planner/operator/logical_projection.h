@@ -22,6 +22,9 @@ public:
     }
 
     inline binder::expression_vector getExpressionsToProject() const { return expressions; }
+    void setExpressionsToProject(binder::expression_vector expressionsToProject) {
+        expressions = std::move(expressionsToProject);
+    }
 
     std::unordered_set<uint32_t> getDiscardedGroupsPos() const;
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "binder/expression/expression_util.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Reads node properties for the node IDs produced by its child, i.e. only for the nodes that
+// survive the filters below it. The properties are added to the factorization group of the node
+// ID.
+class LogicalFetchNodeProperty final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::FETCH_NODE_PROPERTY;
+
+public:
+    LogicalFetchNodeProperty(std::shared_ptr<binder::Expression> nodeID,
+        common::table_id_t tableID, binder::expression_vector properties,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, nodeID{std::move(nodeID)}, tableID{tableID},
+          properties{std::move(properties)} {}
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override {
+        return nodeID->toString() + " " + binder::ExpressionUtil::toString(properties);
+    }
+
+    std::shared_ptr<binder::Expression> getNodeID() const { return nodeID; }
+    common::table_id_t getTableID() const { return tableID; }
+    binder::expression_vector getProperties() const { return properties; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalFetchNodeProperty>(nodeID, tableID, properties,
+            children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> nodeID;
+    common::table_id_t tableID;
+    binder::expression_vector properties;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -72,6 +72,9 @@ public:
     std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
 
     binder::expression_vector getProperties() const { return properties; }
+    void setProperties(binder::expression_vector properties_) {
+        properties = std::move(properties_);
+    }
     void setPropertyPredicates(std::vector<storage::ColumnPredicateSet> predicates) {
         propertyPredicates = std::move(predicates);
     }
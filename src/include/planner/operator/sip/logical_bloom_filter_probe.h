@@ -0,0 +1,38 @@
+#pragma once
+
+#include "common/exception/runtime.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// Discards probe side tuples whose join key is not in the bloom filter built over the keys of a
+// build side of a hash join or intersect. The join operator lists the probes reading its bloom
+// filters in its SIPInfo, and buildIdx identifies the build side (always 0 for hash join).
+class LogicalBloomFilterProbe : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::BLOOM_FILTER_PROBE;
+
+public:
+    LogicalBloomFilterProbe(std::shared_ptr<binder::Expression> key, uint32_t buildIdx,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{type_, std::move(child)}, key{std::move(key)}, buildIdx{buildIdx} {}
+
+    void computeFactorizedSchema() override { copyChildSchema(0); }
+    void computeFlatSchema() override { copyChildSchema(0); }
+
+    std::string getExpressionsForPrinting() const override { return key->toString(); }
+
+    std::shared_ptr<binder::Expression> getKey() const { return key; }
+    uint32_t getBuildIdx() const { return buildIdx; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        throw common::RuntimeException("LogicalBloomFilterProbe::copy() should not be called.");
+    }
+
+private:
+    std::shared_ptr<binder::Expression> key;
+    uint32_t buildIdx;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 namespace kuzu {
 namespace planner {
 
+class LogicalOperator;
+
 enum class SemiMaskPosition : uint8_t {
     NONE = 0,
     ON_BUILD = 1,
@@ -66,11 +69,17 @@ enum class SIPDirection {
  * avoid large materialization probe side intermediate result.
  *
  * During filter push down, we disable semi mask if join condition is not id-based
+ *
+ * Independently of semi masks, a join whose probe side runs after its build sides may pass bloom
+ * filters over its build keys to BloomFilterProbe operators placed on the probe side. This also
+ * covers joins on non-id keys.
  * */
 struct SIPInfo {
     SemiMaskPosition position = SemiMaskPosition::NONE;
     SIPDependency dependency = SIPDependency::NONE;
     SIPDirection direction = SIPDirection::NONE;
+    // LogicalBloomFilterProbe operators reading the bloom filters of this join.
+    std::vector<LogicalOperator*> bloomFilterProbes;
 };
 
 } // namespace planner
@@ -198,6 +198,9 @@ public:
 
     // Plan index-nested-loop join / hash join
     void planInnerJoin(uint32_t leftLevel, uint32_t rightLevel);
+    void planInnerJoinOfPlannedSubgraphs(uint32_t leftLevel, uint32_t rightLevel);
+    void planInnerJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& otherSubgraph, bool flipPlan);
     bool tryPlanINLJoin(const binder::SubqueryGraph& subgraph,
         const binder::SubqueryGraph& otherSubgraph,
         const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes);
@@ -237,6 +240,9 @@ public:
     void appendScanNodeTable(std::shared_ptr<binder::Expression> nodeID,
         std::vector<common::table_id_t> tableIDs, const binder::expression_vector& properties,
         LogicalPlan& plan);
+    void appendFetchNodeProperty(std::shared_ptr<binder::Expression> nodeID,
+        common::table_id_t tableID, const binder::expression_vector& properties,
+        LogicalPlan& plan);
 
     // Append extend operators
     void appendNonRecursiveExtend(const std::shared_ptr<binder::NodeExpression>& boundNode,
@@ -26,6 +26,7 @@ public:
     explicit SubgraphPlans(const binder::SubqueryGraph& subqueryGraph);
 
     inline uint64_t getMaxCost() const { return maxCost; }
+    uint64_t getMinCost() const;
 
     void addPlan(std::unique_ptr<LogicalPlan> plan);
 
@@ -48,7 +49,7 @@ private:
 };
 
 // A DPLevel is a collection of plans per subgraph. All subgraph should have the same number of
-// variables.
+// variables. If there are too many subgraphs, we keep the ones with the cheapest plans.
 class DPLevel {
 public:
     inline bool contains(const binder::SubqueryGraph& subqueryGraph) {
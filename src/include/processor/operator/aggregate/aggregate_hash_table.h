@@ -54,6 +54,7 @@ public:
         const std::vector<function::AggregateFunction>& aggregateFunctions,
         const std::vector<common::LogicalType>& distinctAggKeyTypes, uint64_t numEntriesToAllocate,
         FactorizedTableSchema tableSchema);
+    ~AggregateHashTable() override;
 
     uint8_t* getEntry(uint64_t idx) { return factorizedTable->getTuple(idx); }
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "common/bloom_filter.h"
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/physical_operator.h"
+
+namespace kuzu {
+namespace processor {
+
+// Discards the tuples whose key cannot match any build side key of a hash join or intersect. The
+// bloom filter is shared with the HashJoinSharedState of the join, which fills it when the build
+// side is finalized, i.e. before the probe side pipeline starts.
+class BloomFilterProbe : public PhysicalOperator, public SelVectorOverWriter {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::BLOOM_FILTER_PROBE;
+
+public:
+    BloomFilterProbe(const DataPos& keyPos, std::shared_ptr<common::BloomFilter> bloomFilter,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)}, keyPos{keyPos},
+          bloomFilter{std::move(bloomFilter)}, keyVector{nullptr} {}
+
+    std::shared_ptr<common::BloomFilter> getBloomFilter() const { return bloomFilter; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<BloomFilterProbe>(keyPos, bloomFilter, children[0]->clone(), id,
+            printInfo->copy());
+    }
+
+private:
+    DataPos keyPos;
+    std::shared_ptr<common::BloomFilter> bloomFilter;
+    common::ValueVector* keyVector;
+    std::unique_ptr<common::ValueVector> hashVector;
+};
+
+} // namespace processor
+} // namespace kuzu
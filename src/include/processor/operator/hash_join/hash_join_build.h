@@ -46,9 +46,17 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void setBloomFilter(std::shared_ptr<common::BloomFilter> filter) {
+        bloomFilter = std::move(filter);
+    }
+    common::BloomFilter* getBloomFilter() const { return bloomFilter.get(); }
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    // Filled with the key hashes once the build side is finalized if a BloomFilterProbe on the
+    // probe side pipeline reads it.
+    std::shared_ptr<common::BloomFilter> bloomFilter;
 };
 
 class HashJoinBuildInfo {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/bloom_filter.h"
 #include "processor/result/base_hash_table.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -22,6 +23,8 @@ public:
 
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Inserts the key hash of every tuple into the given bloom filter.
+    void buildBloomFilter(common::BloomFilter& bloomFilter) const;
 
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector& tmpHashResultVector,
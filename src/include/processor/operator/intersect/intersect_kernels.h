@@ -0,0 +1,56 @@
+#pragma once
+
+#include "common/constants.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+enum class IntersectKernelType : uint8_t {
+    // Scalar merge of both lists.
+    MERGE = 0,
+    // Exponential search of each left value in the right list. Used when the right list is much
+    // longer than the left one, e.g. intersecting the adjacency list of a hub node.
+    GALLOPING = 1,
+    // Direct lookup of left values in a table indexed by the offsets of the right list. Used when
+    // the offsets of the right list cover a dense range.
+    DENSE = 2,
+};
+
+// Kernels intersecting two lists of node IDs sorted by offset. All kernels produce the same
+// result as a merge: the i-th occurrence of an offset in the left list is matched with the i-th
+// occurrence of the same offset in the right list. The positions of the matches are written to
+// leftPositions and rightPositions in increasing order, and the number of matches is returned.
+// Both position buffers must be able to hold min(leftSize, rightSize) values.
+struct IntersectKernels {
+    // The thresholds below are tuned with IntersectKernelsTest.DISABLED_Microbenchmark.
+    // Right lists at least GALLOPING_SIZE_RATIO times longer than left lists are galloped through.
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 8;
+    // The dense kernel is used if the offset range of the right list is at most DENSE_RANGE_FACTOR
+    // times the total size of both lists and fits in the lookup table.
+    static constexpr uint64_t DENSE_RANGE_FACTOR = 2;
+    static constexpr uint64_t MAX_DENSE_RANGE = 2 * common::DEFAULT_VECTOR_CAPACITY;
+
+    static IntersectKernelType chooseKernel(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize);
+
+    static uint64_t intersect(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+    static uint64_t intersect(IntersectKernelType kernelType, const common::nodeID_t* left,
+        uint64_t leftSize, const common::nodeID_t* right, uint64_t rightSize,
+        common::sel_t* leftPositions, common::sel_t* rightPositions);
+
+    static uint64_t merge(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+    static uint64_t gallop(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+    static uint64_t denseLookup(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -9,6 +9,7 @@
 #include "common/file_system/file_info.h"
 #include "common/types/types.h"
 #include "processor/operator/persistent/reader/copy_from_error.h"
+#include "processor/operator/persistent/reader/csv/row_boundary_scanner.h"
 
 namespace kuzu {
 namespace common {
@@ -108,9 +109,10 @@ protected:
     inline bool isNewLine(char c) { return c == '\n' || c == '\r'; }
 
 protected:
-    virtual bool handleQuotedNewline() = 0;
-
-    void skipCurrentLine();
+    //! Skips the rest of the current row, starting from the given scanner state. Malformed lines
+    //! are skipped up to the next newline.
+    void skipCurrentLine(
+        CSVRowBoundaryScanner::State state = CSVRowBoundaryScanner::State::SKIP_LINE);
 
     void resetNumRowsInCurrentBlock();
     void increaseNumRowsInCurrentBlock(uint64_t numRows);
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 #include "base_csv_reader.h"
 #include "common/types/types.h"
 #include "function/function.h"
@@ -11,6 +15,33 @@
 namespace kuzu {
 namespace processor {
 
+//! Row boundary scanner states at the start of the blocks of a file. Rows may span blocks through
+//! quoted newlines, so the first row of a block can only be found once the blocks before it have
+//! been scanned. Each block is scanned for all start states at once, which lets threads scan their
+//! blocks in parallel; the start state of a block then follows from the transitions before it.
+class CSVBlockStartStates {
+public:
+    bool hasTransition(common::block_idx_t blockIdx);
+    void setTransition(common::block_idx_t blockIdx,
+        const CSVRowBoundaryScanner::state_transition_t& transition);
+    //! Returns the state at the start of the block, or std::nullopt if a block before it hasn't
+    //! been scanned yet, in which case missingBlockIdx is set to that block. The start state of
+    //! each block can be taken once.
+    std::optional<CSVRowBoundaryScanner::State> takeStartState(common::block_idx_t blockIdx,
+        common::block_idx_t& missingBlockIdx);
+
+private:
+    std::mutex mtx;
+    // The first block whose transition hasn't been applied yet, and the state it starts in.
+    common::block_idx_t nextBlockIdx = 0;
+    CSVRowBoundaryScanner::State nextStartState = CSVRowBoundaryScanner::State::VALUE_START;
+    std::unordered_map<common::block_idx_t, CSVRowBoundaryScanner::state_transition_t>
+        transitions;
+    // Start states of the blocks before nextBlockIdx that haven't been taken yet.
+    std::unordered_map<common::block_idx_t, CSVRowBoundaryScanner::State> startStates{
+        {0, CSVRowBoundaryScanner::State::VALUE_START}};
+};
+
 //! ParallelCSVReader is a class that reads values from a stream in parallel.
 class ParallelCSVReader final : public BaseCSVReader {
     friend class ParallelParsingDriver;
@@ -18,7 +49,7 @@ class ParallelCSVReader final : public BaseCSVReader {
 public:
     ParallelCSVReader(const std::string& filePath, common::idx_t fileIdx, common::CSVOption option,
         CSVColumnInfo columnInfo, main::ClientContext* context,
-        LocalFileErrorHandler* errorHandler);
+        LocalFileErrorHandler* errorHandler, CSVBlockStartStates* blockStartStates);
 
     bool hasMoreToRead() const;
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
@@ -26,12 +57,16 @@ public:
 
     void reportFinishedBlock();
 
-protected:
-    bool handleQuotedNewline() override;
-
 private:
     bool finishedBlock() const;
     void seekToBlockStart();
+    CSVRowBoundaryScanner::State getBlockStartState();
+    CSVRowBoundaryScanner::state_transition_t scanBlock(common::block_idx_t blockIdx);
+
+private:
+    CSVRowBoundaryScanner rowBoundaryScanner;
+    CSVBlockStartStates* blockStartStates;
+    std::unique_ptr<char[]> blockData;
 };
 
 struct ParallelCSVLocalState final : public function::TableFuncLocalState {
@@ -45,6 +80,7 @@ struct ParallelCSVScanSharedState final : public function::ScanFileSharedState {
     CSVColumnInfo columnInfo;
     uint64_t numBlocksReadByFiles = 0;
     std::vector<SharedFileErrorHandler> errorHandlers;
+    std::vector<std::unique_ptr<CSVBlockStartStates>> blockStartStates;
     populate_func_t populateErrorFunc;
 
     ParallelCSVScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/copier_config/csv_reader_config.h"
+
+namespace kuzu {
+namespace processor {
+
+// Finds the first occurrence of any of a small set of characters, 16 bytes at a time if SSE2 is
+// available.
+class CharSetFinder {
+public:
+    static constexpr uint8_t MAX_NUM_CHARS = 6;
+
+    CharSetFinder(std::initializer_list<char> chars);
+
+    // Returns the offset of the first character of data in the set, or size if there is none.
+    uint64_t find(const char* data, uint64_t size) const {
+        uint64_t offset = 0;
+#if defined(__SSE2__)
+        for (; offset + sizeof(__m128i) <= size; offset += sizeof(__m128i)) {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+            auto matches = _mm_cmpeq_epi8(block, simdChars[0]);
+            for (auto i = 1u; i < numChars; i++) {
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, simdChars[i]));
+            }
+            const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+            if (mask != 0) {
+                return offset + std::countr_zero(mask);
+            }
+        }
+#endif
+        for (; offset < size; offset++) {
+            if (contains(data[offset])) {
+                return offset;
+            }
+        }
+        return size;
+    }
+
+private:
+    bool contains(char c) const {
+        for (auto i = 0u; i < numChars; i++) {
+            if (chars[i] == c) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::array<char, MAX_NUM_CHARS> chars;
+    uint8_t numChars;
+#if defined(__SSE2__)
+    __m128i simdChars[MAX_NUM_CHARS];
+#endif
+};
+
+// Finds where rows end in a CSV file without parsing its values. It follows the state machine of
+// BaseCSVReader::parseCSV, including how the parser skips malformed lines, so the rows it finds
+// are the rows the parser reads. A newline only ends a row outside of quoted values.
+class CSVRowBoundaryScanner {
+public:
+    enum class State : uint8_t {
+        VALUE_START = 0,
+        NORMAL = 1, // In an unquoted value.
+        IN_QUOTES = 2,
+        UNQUOTE = 3,   // Right after the quote closing a value.
+        ESCAPE = 4,    // Right after an escape character in a quoted value.
+        SKIP_LINE = 5, // Skipping the rest of a malformed line.
+    };
+    static constexpr uint8_t NUM_STATES = 6;
+    // The state at the end of some data for each state at its start.
+    using state_transition_t = std::array<State, NUM_STATES>;
+    static constexpr state_transition_t IDENTITY = {State::VALUE_START, State::NORMAL,
+        State::IN_QUOTES, State::UNQUOTE, State::ESCAPE, State::SKIP_LINE};
+
+    explicit CSVRowBoundaryScanner(const common::CSVOption& option);
+
+    static State step(const common::CSVOption& option, State state, char c);
+    static bool isRowEnd(const common::CSVOption& option, State state, char c) {
+        return (c == '\n' || c == '\r') && step(option, state, c) == State::VALUE_START;
+    }
+
+    State step(State state, char c) const {
+        return byteTransitions[static_cast<uint8_t>(c)][static_cast<uint8_t>(state)];
+    }
+    bool isRowEnd(State state, char c) const {
+        return (c == '\n' || c == '\r') && step(state, c) == State::VALUE_START;
+    }
+
+    // Computes the transition over the data for all start states in a single pass, so that data
+    // can be scanned before the state at its start is known.
+    state_transition_t computeTransition(const char* data, uint64_t size) const;
+
+    static State apply(const state_transition_t& transition, State state) {
+        return transition[static_cast<uint8_t>(state)];
+    }
+
+private:
+    std::array<state_transition_t, 256> byteTransitions;
+    // Transition of the bytes that are not special characters. Applying it more than once has the
+    // same effect as applying it once.
+    state_transition_t otherTransition;
+    CharSetFinder specialCharFinder;
+};
+
+} // namespace processor
+} // namespace kuzu
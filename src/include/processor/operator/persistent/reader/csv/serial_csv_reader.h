@@ -22,9 +22,6 @@ public:
         DialectOption& detectedDialect);
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
 
-protected:
-    bool handleQuotedNewline() override { return true; }
-
 private:
     const function::ScanTableFuncBindInput* bindInput;
     void resetReaderState();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "column_reader.h"
 #include "common/data_chunk/data_chunk.h"
 #include "common/file_system/virtual_file_system.h"
@@ -8,6 +10,7 @@
 #include "function/table/scan_functions.h"
 #include "parquet/parquet_types.h"
 #include "resizable_buffer.h"
+#include "storage/predicate/column_predicate.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
 namespace kuzu {
@@ -49,6 +52,10 @@ public:
     bool scanInternal(ParquetReaderScanState& state, common::DataChunk& result);
     void scan(ParquetReaderScanState& state, common::DataChunk& result);
     uint64_t getNumRowsGroups() { return metadata->row_groups.size(); }
+    // Returns true if the column chunk statistics of the row group show that none of its rows
+    // satisfies the predicates, which are indexed by column.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<storage::ColumnPredicateSet>& columnPredicates) const;
 
     uint32_t getNumColumns() const { return columnNames.size(); }
     std::string getColumnName(uint32_t idx) const { return columnNames[idx]; }
@@ -71,10 +78,11 @@ private:
     }
     static common::LogicalType deriveLogicalType(const kuzu_parquet::format::SchemaElement& s_ele);
     void initMetadata();
+    void initColumns();
     std::unique_ptr<ColumnReader> createReader();
     std::unique_ptr<ColumnReader> createReaderRecursive(uint64_t depth, uint64_t maxDefine,
         uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx);
-    void prepareRowGroupBuffer(ParquetReaderScanState& state, uint64_t colIdx);
+    void prepareRowGroupBuffer(ParquetReaderScanState& state);
     // Group span is the distance between the min page offset and the max page offset plus the max
     // page compressed size
     uint64_t getGroupSpan(ParquetReaderScanState& state);
@@ -86,19 +94,30 @@ private:
     std::vector<bool> columnSkips;
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnTypes;
+    std::vector<uint64_t> columnSchemaIdxes;
+    // Index of the column chunk of each column in a row group, or INVALID_COLUMN_ID for nested
+    // columns, which are stored in more than one chunk.
+    std::vector<common::column_id_t> columnChunkIdxes;
 
     std::unique_ptr<kuzu_parquet::format::FileMetaData> metadata;
     main::ClientContext* context;
 };
 
+struct ParquetRowGroupToScan {
+    common::idx_t fileIdx;
+    uint64_t groupIdx;
+};
+
 struct ParquetScanSharedState final : public function::ScanFileSharedState {
-    explicit ParquetScanSharedState(const common::ReaderConfig readerConfig, uint64_t numRows,
-        main::ClientContext* context, std::vector<bool> columnSkips);
+    ParquetScanSharedState(common::ReaderConfig readerConfig, main::ClientContext* context,
+        std::vector<bool> columnSkips,
+        const std::vector<storage::ColumnPredicateSet>& columnPredicates);
 
     std::vector<std::unique_ptr<ParquetReader>> readers;
-    std::vector<bool> columnSkips;
-    uint64_t totalRowsGroups;
-    uint64_t numBlocksReadByFiles;
+    // Row groups of all files that are not pruned by the column predicates. Threads claim them
+    // in order through nextRowGroupIdx.
+    std::vector<ParquetRowGroupToScan> rowGroupsToScan;
+    std::atomic<uint64_t> nextRowGroupIdx;
 };
 
 struct ParquetScanLocalState final : public function::TableFuncLocalState {
@@ -124,6 +124,10 @@ private:
         common::offset_t startOffset);
     static void setRowIdxFromCSROffsets(storage::ColumnChunkData& rowIdxChunk,
         storage::ColumnChunkData& csrOffsetChunk);
+    // Same as setRowIdxFromCSROffsets, but places the rels of each node in order of their
+    // neighbour offsets.
+    static void setRowIdxSortedByNbrOffset(storage::InMemChunkedNodeGroupCollection& partition,
+        common::column_id_t boundNodeOffsetColumn, storage::ColumnChunkData& csrOffsetChunk);
 
     static void checkRelMultiplicityConstraint(const storage::ChunkedCSRHeader& csrHeader,
         common::offset_t startNodeOffset, const RelBatchInsertInfo& relInfo);
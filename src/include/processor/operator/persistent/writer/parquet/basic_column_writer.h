@@ -19,6 +19,10 @@ public:
     std::vector<PageWriteInformation> writeInfo;
     std::unique_ptr<ColumnWriterStatistics> statsState;
     uint64_t currentPage = 0;
+    // The page headers and compressed pages of the column chunk, ready to be appended to the file.
+    std::unique_ptr<common::BufferedSerializer> chunkData;
+    // Offset of the first data page in chunkData, which follows the dictionary page if any.
+    uint64_t dataPageOffset = 0;
 };
 
 class BasicColumnWriter : public ColumnWriter {
@@ -36,6 +40,7 @@ public:
         uint64_t count) override;
     void beginWrite(ColumnWriterState& state) override;
     void write(ColumnWriterState& state, common::ValueVector* vector, uint64_t count) override;
+    void finalizePages(ColumnWriterState& state) override;
     void finalizeWrite(ColumnWriterState& state) override;
 
 protected:
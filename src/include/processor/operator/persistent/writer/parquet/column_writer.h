@@ -41,6 +41,8 @@ public:
     std::vector<uint16_t> definitionLevels;
     std::vector<uint16_t> repetitionLevels;
     std::vector<bool> isEmpty;
+    // Number of nulls in the column chunk of the row group.
+    uint64_t nullCount = 0;
 };
 
 class ColumnWriterStatistics {
@@ -83,6 +85,10 @@ public:
         common::ValueVector* vector, uint64_t count) = 0;
     virtual void beginWrite(ColumnWriterState& state) = 0;
     virtual void write(ColumnWriterState& state, common::ValueVector* vector, uint64_t count) = 0;
+    // Encodes and compresses what is left of the column chunk in memory. It does not touch the
+    // file, so row groups can be finalized concurrently.
+    virtual void finalizePages(ColumnWriterState& state) = 0;
+    // Appends the column chunk to the file. Calls are serialized by the ParquetWriter.
     virtual void finalizeWrite(ColumnWriterState& state) = 0;
     inline uint64_t getVectorPos(common::ValueVector* vector, uint64_t idx) {
         return (vector->state == nullptr || !vector->state->isFlat()) ? idx : 0;
@@ -94,8 +100,6 @@ public:
     uint64_t maxRepeat;
     uint64_t maxDefine;
     bool canHaveNulls;
-    // collected stats
-    uint64_t nullCount;
 
 protected:
     void handleDefineLevels(ColumnWriterState& state, ColumnWriterState* parent,
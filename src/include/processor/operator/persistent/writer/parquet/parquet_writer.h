@@ -36,6 +36,26 @@ private:
     common::offset_t& offset;
 };
 
+// Serializes thrift objects into memory, before their position in the file is known.
+class ParquetWriterBufferTransport : public kuzu_apache::thrift::protocol::TTransport {
+public:
+    explicit ParquetWriterBufferTransport(common::BufferedSerializer& serializer)
+        : serializer{serializer} {}
+
+    inline bool isOpen() const override { return true; }
+
+    void open() override {}
+
+    void close() override {}
+
+    inline void write_virt(const uint8_t* buf, uint32_t len) override {
+        serializer.write(buf, len);
+    }
+
+private:
+    common::BufferedSerializer& serializer;
+};
+
 struct PreparedRowGroup {
     kuzu_parquet::format::RowGroup rowGroup;
     std::vector<std::unique_ptr<ColumnWriterState>> states;
@@ -14,8 +14,10 @@ enum class PhysicalOperatorType : uint8_t {
     AGGREGATE_SCAN,
     ATTACH_DATABASE,
     BATCH_INSERT,
+    BLOOM_FILTER_PROBE,
     COPY_RDF,
     COPY_TO,
+    COUNT_REL_TABLE,
     CREATE_MACRO,
     CREATE_SEQUENCE,
     CREATE_TABLE,
@@ -26,6 +28,7 @@ enum class PhysicalOperatorType : uint8_t {
     DROP,
     EMPTY_RESULT,
     EXPORT_DATABASE,
+    FETCH_NODE_PROPERTY,
     FILTER,
     FLATTEN,
     GDS_CALL,
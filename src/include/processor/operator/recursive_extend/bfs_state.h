@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
 
 #include "frontier.h"
 
@@ -30,6 +31,13 @@ public:
     }
 
     inline uint64_t getNumNodes() const { return numNodes; }
+    // Returns the only target node, or an invalid node ID if there is more than one target.
+    inline common::nodeID_t getSingleNodeID() const {
+        if (numNodes != 1 || nodeIDs.size() != 1) {
+            return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+        }
+        return *nodeIDs.begin();
+    }
 
 private:
     uint64_t numNodes;
@@ -64,6 +72,12 @@ public:
     virtual void markSrc(common::nodeID_t nodeID) = 0;
     virtual void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) = 0;
+    // Same as markVisited, but can be called by multiple threads extending the current frontier.
+    virtual void markVisitedConcurrently(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID, uint64_t multiplicity) {
+        std::unique_lock lck{mtx};
+        markVisited(boundNodeID, nbrNodeID, relID, multiplicity);
+    }
     inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
         return currentFrontier->getMultiplicity(nodeID);
     }
@@ -71,6 +85,26 @@ public:
     inline void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
     inline size_t getNumFrontiers() const { return frontiers.size(); }
     inline Frontier* getFrontier(common::idx_t idx) const { return frontiers[idx].get(); }
+    inline const Frontier* getCurrentFrontier() const { return currentFrontier; }
+    inline bool isAtStartOfLevel() const { return nextNodeIdxToExtend == 0; }
+
+    // Replaces the frontiers with the given path from the src node, e.g. a path computed by a
+    // bidirectional BFS, so that it is output by the frontier scanners.
+    void setPath(const std::vector<common::nodeID_t>& nodeIDs,
+        const std::vector<common::relID_t>& relIDs, bool trackPath) {
+        KU_ASSERT(nodeIDs.size() == relIDs.size() + 1);
+        frontiers.clear();
+        initStartFrontier();
+        currentFrontier->addNodeWithMultiplicity(nodeIDs[0], 1);
+        for (auto i = 1u; i < nodeIDs.size(); ++i) {
+            addNextFrontier();
+            if (trackPath) {
+                nextFrontier->addEdge(nodeIDs[i - 1], nodeIDs[i], relIDs[i - 1]);
+            } else {
+                nextFrontier->addNodeWithMultiplicity(nodeIDs[i], 1);
+            }
+        }
+    }
 
 protected:
     inline bool isCurrentFrontierEmpty() const { return currentFrontier->nodeIDs.empty(); }
@@ -105,6 +139,8 @@ protected:
     std::vector<std::unique_ptr<Frontier>> frontiers;
     // Target information.
     TargetDstNodes* targetDstNodes;
+    // Protects the next frontier while multiple threads extend the current one.
+    std::mutex mtx;
 };
 
 } // namespace processor
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+// One side of a bidirectional BFS. Each visited node is mapped to the node it was discovered from
+// and the rel connecting them, so the path back to the start node can be reconstructed.
+class BFSSide {
+public:
+    void resetState(common::nodeID_t startNodeID);
+
+    inline bool isVisited(common::nodeID_t nodeID) const { return parents.contains(nodeID); }
+    // Returns false if the nbr node has been visited before.
+    bool markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID);
+    void finalizeCurrentLevel();
+
+    inline const std::vector<common::nodeID_t>& getCurrentFrontier() const {
+        return currentFrontier;
+    }
+    inline uint8_t getCurrentLevel() const { return currentLevel; }
+    // Appends the rels and nodes on the path from the start node to the given node, ordered from
+    // the given node to the start node.
+    void appendPathToStart(common::nodeID_t nodeID, std::vector<common::nodeID_t>& nodeIDs,
+        std::vector<common::relID_t>& relIDs) const;
+
+private:
+    uint8_t currentLevel = 0;
+    std::vector<common::nodeID_t> currentFrontier;
+    std::vector<common::nodeID_t> nextFrontier;
+    common::node_id_map_t<node_rel_id_t> parents;
+};
+
+// State of a shortest path BFS between a single src and a single dst node, expanding from both
+// ends. Every step extends the whole current level of the side with the smaller frontier. Once a
+// node discovered by one side has been visited by the other side, the path through it is a
+// shortest path: if the sides are at levels a and b, no path shorter than a + b + 1 exists
+// because the nodes visited so far by both sides are disjoint.
+class BidirectionalBFSState {
+public:
+    explicit BidirectionalBFSState(uint8_t upperBound)
+        : upperBound{upperBound}, pathFound{false} {}
+
+    void resetState(common::nodeID_t srcNodeID, common::nodeID_t dstNodeID);
+    bool isComplete() const;
+
+    // The side to extend next, i.e. the one with the smaller frontier.
+    inline bool shouldExtendFromSrc() const {
+        return srcSide.getCurrentFrontier().size() <= dstSide.getCurrentFrontier().size();
+    }
+    inline BFSSide& getSide(bool fromSrc) { return fromSrc ? srcSide : dstSide; }
+    // Returns true if a shortest path has been found through the given edge.
+    bool markVisited(bool fromSrc, common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID);
+
+    // Writes the shortest path found, if any, into the frontiers of the given BFS state.
+    void writePath(BaseBFSState& bfsState, bool trackPath) const;
+
+private:
+    uint8_t upperBound;
+    BFSSide srcSide;
+    BFSSide dstSide;
+    bool pathFound;
+    std::vector<common::nodeID_t> pathNodeIDs;
+    std::vector<common::relID_t> pathRelIDs;
+};
+
+} // namespace processor
+} // namespace kuzu
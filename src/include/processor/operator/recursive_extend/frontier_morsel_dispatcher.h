@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+// Shares the current frontier of a BFS with other threads. The frontier is split into morsels of
+// nodes that are extended concurrently into the next frontier of the same BFS state.
+class FrontierMorselDispatcher {
+    friend class SharedFrontiers;
+
+public:
+    static constexpr uint64_t MORSEL_SIZE = 64;
+    // Smaller frontiers are extended by the thread computing the BFS only.
+    static constexpr uint64_t MIN_FRONTIER_SIZE_TO_SHARE = 4 * MORSEL_SIZE;
+
+    FrontierMorselDispatcher()
+        : bfsState{nullptr}, isFirstLevel{false}, frontierSize{0}, nextIdx{0}, numHelpers{0} {}
+
+    void init(BaseBFSState* state, bool firstLevel) {
+        bfsState = state;
+        isFirstLevel = firstLevel;
+        frontierSize = state->getCurrentFrontier()->nodeIDs.size();
+        nextIdx.store(0);
+    }
+
+    BaseBFSState* getBFSState() const { return bfsState; }
+    bool extendsFirstLevel() const { return isFirstLevel; }
+
+    // Returns false if all morsels of the frontier have been handed out.
+    bool getMorsel(uint64_t& startIdx, uint64_t& endIdx) {
+        startIdx = nextIdx.fetch_add(MORSEL_SIZE);
+        if (startIdx >= frontierSize) {
+            return false;
+        }
+        endIdx = std::min(startIdx + MORSEL_SIZE, frontierSize);
+        return true;
+    }
+    bool hasMoreMorsels() const { return nextIdx.load() < frontierSize; }
+
+private:
+    BaseBFSState* bfsState;
+    bool isFirstLevel;
+    uint64_t frontierSize;
+    std::atomic<uint64_t> nextIdx;
+    // Number of threads other than the owner working on the frontier. Protected by the mutex of
+    // SharedFrontiers.
+    uint64_t numHelpers;
+};
+
+// Frontiers that are shared by the threads of a recursive join. Threads that run out of source
+// nodes help extending the frontiers of BFSs that are still running.
+class SharedFrontiers {
+public:
+    SharedFrontiers() : numRunningBFS{0} {}
+
+    void startBFS();
+    void finishBFS();
+
+    void publish(FrontierMorselDispatcher* dispatcher);
+    // Stops handing out the frontier and waits until all helpers are done with it.
+    void unpublish(FrontierMorselDispatcher* dispatcher);
+
+    // Blocks until a frontier with remaining morsels is published, or returns nullptr if no BFS is
+    // running anymore.
+    FrontierMorselDispatcher* acquire();
+    void release(FrontierMorselDispatcher* dispatcher);
+
+private:
+    FrontierMorselDispatcher* getDispatcherWithMorsels() const;
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numRunningBFS;
+    std::vector<FrontierMorselDispatcher*> dispatchers;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "bidirectional_bfs_state.h"
 #include "common/enums/extend_direction.h"
 #include "common/enums/query_rel_type.h"
 #include "common/mask.h"
+#include "frontier_morsel_dispatcher.h"
 #include "frontier_scanner.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/physical_operator.h"
@@ -14,10 +16,11 @@ namespace processor {
 class OffsetScanNodeTable;
 
 struct RecursiveJoinSharedState {
-    std::vector<std::unique_ptr<common::NodeOffsetLevelSemiMask>> semiMasks;
+    std::vector<std::unique_ptr<common::NodeSemiMask>> semiMasks;
+    SharedFrontiers frontiers;
 
     explicit RecursiveJoinSharedState(
-        std::vector<std::unique_ptr<common::NodeOffsetLevelSemiMask>> semiMasks)
+        std::vector<std::unique_ptr<common::NodeSemiMask>> semiMasks)
         : semiMasks{std::move(semiMasks)} {}
 };
 
@@ -111,10 +114,13 @@ class RecursiveJoin : public PhysicalOperator {
 public:
     RecursiveJoin(RecursiveJoinInfo info, std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
-        std::unique_ptr<PhysicalOperator> recursiveRoot, std::unique_ptr<OPPrintInfo> printInfo)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> reverseRecursiveRoot,
+        std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           info{std::move(info)}, sharedState{std::move(sharedState)},
-          recursiveRoot{std::move(recursiveRoot)}, recursiveSource{nullptr} {}
+          recursiveRoot{std::move(recursiveRoot)}, recursiveSource{nullptr},
+          reverseRecursiveRoot{std::move(reverseRecursiveRoot)}, reverseRecursiveSource{nullptr} {}
 
     std::vector<common::NodeSemiMask*> getSemiMask() const;
 
@@ -124,11 +130,13 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() final {
         return std::make_unique<RecursiveJoin>(info.copy(), sharedState, children[0]->clone(), id,
-            recursiveRoot->clone(), printInfo->copy());
+            recursiveRoot->clone(),
+            reverseRecursiveRoot ? reverseRecursiveRoot->clone() : nullptr, printInfo->copy());
     }
 
 private:
     void initLocalRecursivePlan(ExecutionContext* context);
+    void initLocalReverseRecursivePlan(ExecutionContext* context);
 
     void populateTargetDstNodes(ExecutionContext* context);
 
@@ -136,8 +144,21 @@ private:
 
     // Compute BFS for a given src node.
     void computeBFS(ExecutionContext* context);
-
-    void updateVisitedNodes(common::nodeID_t boundNodeID);
+    // Extends the current frontier together with other threads.
+    void computeLevelInParallel(ExecutionContext* context);
+    // Helps extending the frontiers of BFSs computed by other threads until all of them finish.
+    void helpComputeBFS(ExecutionContext* context);
+    void extendFrontierMorsels(ExecutionContext* context, FrontierMorselDispatcher& dispatcher);
+    void extend(ExecutionContext* context, BaseBFSState& state, common::nodeID_t boundNodeID,
+        bool concurrently);
+
+    void updateVisitedNodes(BaseBFSState& state, common::nodeID_t boundNodeID, bool concurrently);
+
+    // Compute shortest path between a src and a dst node by extending from both of them.
+    void computeBidirectionalBFS(ExecutionContext* context, common::nodeID_t srcNodeID,
+        common::nodeID_t dstNodeID);
+    // Extends the current frontier of one side of the bidirectional BFS.
+    void extendBidirectional(ExecutionContext* context, bool fromSrc);
 
 private:
     RecursiveJoinInfo info;
@@ -147,9 +168,18 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     OffsetScanNodeTable* recursiveSource;
+    // Local recursive plan extending in the opposite direction. Only planned for shortest paths
+    // between point lookups, otherwise null.
+    std::unique_ptr<ResultSet> reverseLocalResultSet;
+    std::unique_ptr<PhysicalOperator> reverseRecursiveRoot;
+    OffsetScanNodeTable* reverseRecursiveSource;
+    std::unique_ptr<RecursiveJoinVectors> reverseVectors;
+    std::unique_ptr<BidirectionalBFSState> bidirectionalBFSState;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
+    // Null if the BFS is computed by a single thread.
+    std::unique_ptr<FrontierMorselDispatcher> frontierDispatcher;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
 };
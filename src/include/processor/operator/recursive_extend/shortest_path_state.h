@@ -1,28 +1,94 @@
 #pragma once
 
+#include <atomic>
+
 #include "bfs_state.h"
 
 namespace kuzu {
 namespace processor {
 
+// Nodes visited by a BFS. Nodes of the given tables whose offsets are below the given number of
+// nodes are tracked in atomic bitmaps, so threads extending the same frontier can mark them without
+// locking. Other nodes, e.g. nodes created by the current transaction, are tracked in a set.
+class VisitedNodes {
+    struct Bitmap {
+        common::offset_t numNodes;
+        std::unique_ptr<std::atomic<uint64_t>[]> words;
+
+        explicit Bitmap(common::offset_t numNodes)
+            : numNodes{numNodes}, words{std::make_unique<std::atomic<uint64_t>[]>(
+                                      (numNodes + 63) / 64)} {}
+    };
+
+public:
+    explicit VisitedNodes(const common::table_id_map_t<common::offset_t>& numNodesPerTable) {
+        for (auto& [tableID, numNodes] : numNodesPerTable) {
+            bitmaps.emplace(tableID, Bitmap(numNodes));
+        }
+    }
+
+    // Returns false if the node has been marked before.
+    bool tryMark(common::nodeID_t nodeID) {
+        if (auto bitmap = getBitmap(nodeID)) {
+            const auto mask = getMask(nodeID.offset);
+            return !(bitmap->words[nodeID.offset / 64].fetch_or(mask, std::memory_order_relaxed) &
+                     mask);
+        }
+        std::unique_lock lck{mtx};
+        return otherNodes.insert(nodeID).second;
+    }
+
+    // Unmarks the given nodes. Clearing only the visited nodes keeps resetting cheap for small
+    // BFSs over large tables.
+    void unmark(const std::vector<common::nodeID_t>& nodeIDs) {
+        for (auto& nodeID : nodeIDs) {
+            if (auto bitmap = getBitmap(nodeID)) {
+                bitmap->words[nodeID.offset / 64].fetch_and(~getMask(nodeID.offset),
+                    std::memory_order_relaxed);
+            }
+        }
+        otherNodes.clear();
+    }
+
+private:
+    Bitmap* getBitmap(common::nodeID_t nodeID) {
+        auto it = bitmaps.find(nodeID.tableID);
+        if (it == bitmaps.end() || nodeID.offset >= it->second.numNodes) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+    static uint64_t getMask(common::offset_t offset) { return (uint64_t)1 << (offset % 64); }
+
+private:
+    common::table_id_map_t<Bitmap> bitmaps;
+    std::mutex mtx;
+    common::node_id_set_t otherNodes;
+};
+
 template<bool TRACK_PATH>
 class ShortestPathState : public BaseBFSState {
 public:
-    ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0} {}
+    ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        const common::table_id_map_t<common::offset_t>& numNodesPerTable)
+        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0},
+          visited{numNodesPerTable} {}
     ~ShortestPathState() override = default;
 
     inline bool isComplete() final {
         return isCurrentFrontierEmpty() || isUpperBoundReached() || isAllDstReached();
     }
     inline void resetState() final {
+        // All visited nodes are in the frontiers.
+        for (auto i = 0u; i < getNumFrontiers(); i++) {
+            visited.unmark(getFrontier(i)->nodeIDs);
+        }
         BaseBFSState::resetState();
         numVisitedDstNodes = 0;
-        visited.clear();
     }
 
     inline void markSrc(common::nodeID_t nodeID) final {
-        visited.insert(nodeID);
+        visited.tryMark(nodeID);
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
@@ -31,10 +97,26 @@ public:
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
-        if (visited.contains(nbrNodeID)) {
+        if (!visited.tryMark(nbrNodeID)) {
             return;
         }
-        visited.insert(nbrNodeID);
+        addToNextFrontier(boundNodeID, nbrNodeID, relID);
+    }
+
+    inline void markVisitedConcurrently(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::nodeID_t relID, uint64_t /*multiplicity*/) final {
+        // Most neighbours of a large frontier are visited already, so they are filtered out
+        // before taking the lock.
+        if (!visited.tryMark(nbrNodeID)) {
+            return;
+        }
+        std::unique_lock lck{mtx};
+        addToNextFrontier(boundNodeID, nbrNodeID, relID);
+    }
+
+private:
+    inline void addToNextFrontier(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::nodeID_t relID) {
         if (targetDstNodes->contains(nbrNodeID)) {
             numVisitedDstNodes++;
         }
@@ -45,14 +127,13 @@ public:
         }
     }
 
-private:
     inline bool isAllDstReached() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes();
     }
 
 private:
     uint64_t numVisitedDstNodes;
-    common::node_id_set_t visited;
+    VisitedNodes visited;
 };
 
 } // namespace processor
@@ -3,6 +3,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_chunk_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,15 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // When a chunk queue is set, local tables are handed to the queue chunk by chunk instead of
+    // being merged into the shared table, which then only serves as the (empty) result schema.
+    void setChunkQueue(std::shared_ptr<ResultChunkQueue> queue) { chunkQueue = std::move(queue); }
+    ResultChunkQueue* getChunkQueue() const { return chunkQueue.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<ResultChunkQueue> chunkQueue;
 };
 
 struct ResultCollectorInfo {
@@ -76,6 +83,15 @@ public:
 
     std::shared_ptr<FactorizedTable> getResultFactorizedTable() { return sharedState->getTable(); }
 
+    // Optional accumulation appends a null tuple to an empty result on finalization, which
+    // requires the full result.
+    bool canStreamResult() const { return info.accumulateType == common::AccumulateType::REGULAR; }
+    void streamResultTo(std::shared_ptr<ResultChunkQueue> queue) {
+        KU_ASSERT(canStreamResult());
+        sharedState->setChunkQueue(std::move(queue));
+    }
+    bool isStreamingResult() const { return sharedState->getChunkQueue() != nullptr; }
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info.copy(), sharedState,
             children[0]->clone(), id, printInfo->copy());
@@ -84,6 +100,8 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
+    void pushLocalTableToChunkQueue(ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
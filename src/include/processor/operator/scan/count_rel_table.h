@@ -0,0 +1,44 @@
+#pragma once
+
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/physical_operator.h"
+#include "storage/store/rel_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Writes the number of rels of each input bound node in the given direction of a rel table into
+// the count vector, which is in the same data chunk as the bound nodes. Counts are read from the
+// CSR header and version info only. Bound nodes without rels are filtered out.
+class CountRelTable final : public PhysicalOperator, public SelVectorOverWriter {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::COUNT_REL_TABLE;
+
+public:
+    CountRelTable(storage::RelTable* table, common::RelDataDirection direction,
+        const DataPos& nodeIDPos, const DataPos& countPos, std::unique_ptr<PhysicalOperator> child,
+        uint32_t id, std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)}, table{table},
+          direction{direction}, nodeIDPos{nodeIDPos}, countPos{countPos}, nodeIDVector{nullptr},
+          countVector{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<CountRelTable>(table, direction, nodeIDPos, countPos,
+            children[0]->clone(), id, printInfo->copy());
+    }
+
+private:
+    storage::RelTable* table;
+    common::RelDataDirection direction;
+    DataPos nodeIDPos;
+    DataPos countPos;
+    common::ValueVector* nodeIDVector;
+    common::ValueVector* countVector;
+    std::unique_ptr<storage::RelTableScanState> scanState;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Looks up node properties for the node IDs of its input, so that properties are only read for
+// the nodes that survive the operators below it. Nodes are grouped by node group, so that the scan
+// state and the node group lock are set up once per group. Rows are still looked up one by one.
+class FetchNodeProperty final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::FETCH_NODE_PROPERTY;
+
+public:
+    FetchNodeProperty(ScanTableInfo info, ScanNodeTableInfo nodeInfo,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(info), std::move(child), id, std::move(printInfo)},
+          nodeInfo{std::move(nodeInfo)}, nodeIDVector{nullptr} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<FetchNodeProperty>(info.copy(), nodeInfo.copy(),
+            children[0]->clone(), id, printInfo->copy());
+    }
+
+private:
+    void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const override;
+
+    // Looks up the selected nodes, which are all in the node group of the given offset. Nodes which
+    // are not visible to the transaction get null properties.
+    void lookup(transaction::Transaction* transaction, common::offset_t offset);
+
+private:
+    ScanNodeTableInfo nodeInfo;
+    common::ValueVector* nodeIDVector;
+    // Selected positions of the input, and the positions of non-null node IDs sorted by offset.
+    std::vector<common::sel_t> selectedPositions;
+    std::vector<common::sel_t> positionsToLookup;
+};
+
+} // namespace processor
+} // namespace kuzu
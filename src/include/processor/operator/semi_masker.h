@@ -9,9 +9,7 @@ namespace processor {
 class BaseSemiMasker;
 
 // Multiple maskers can point to the same SemiMask, thus we associate each masker with an idx
-// to indicate the execution sequence of its pipeline. Also, the maskerIdx is used as a flag to
-// indicate if a value in the mask is masked or not, as each masker will increment the selected
-// value in the mask by 1. More details are described in NodeTableSemiMask.
+// that identifies the bitmap it fills in the mask. More details are described in NodeSemiMask.
 using mask_with_idx = std::pair<common::NodeSemiMask*, uint8_t>;
 
 class SemiMaskerInfo {
@@ -71,9 +69,24 @@ protected:
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
+    common::RoaringBitmap& getSingleTableLocalMask() {
+        KU_ASSERT(localMasks.size() == 1);
+        return localMasks.begin()->second;
+    }
+    common::RoaringBitmap& getTableLocalMask(common::table_id_t tableID) {
+        KU_ASSERT(localMasks.contains(tableID));
+        return localMasks.at(tableID);
+    }
+    // Merges the offsets collected by this thread into the shared masks. Called once the child
+    // is exhausted.
+    void mergeLocalMasks();
+
 protected:
     std::unique_ptr<SemiMaskerInfo> info;
     common::ValueVector* keyVector;
+    // Offsets collected by this thread for each table. They are merged into all masks of the
+    // table.
+    std::unordered_map<common::table_id_t, common::RoaringBitmap> localMasks;
 };
 
 class SingleTableSemiMasker : public BaseSemiMasker {
@@ -29,6 +29,7 @@ class LogicalCopyFrom;
 namespace processor {
 
 class HashJoinBuildInfo;
+class HashJoinSharedState;
 struct AggregateInfo;
 class NodeInsertExecutor;
 class RelInsertExecutor;
@@ -57,11 +58,14 @@ private:
     std::unique_ptr<PhysicalOperator> mapAggregate(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapAlter(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapAttachDatabase(planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapBloomFilterProbe(
+        planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyFrom(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyNodeFrom(planner::LogicalOperator* logicalOperator);
     physical_op_vector_t mapCopyRelFrom(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyRdfFrom(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCopyTo(planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapCountRelTable(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCreateMacro(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCreateSequence(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapCreateTable(planner::LogicalOperator* logicalOperator);
@@ -80,6 +84,8 @@ private:
     std::unique_ptr<PhysicalOperator> mapExtend(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapExtension(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapExportDatabase(planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapFetchNodeProperty(
+        planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapFilter(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapFlatten(planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapGDSCall(planner::LogicalOperator* logicalOperator);
@@ -199,6 +205,10 @@ private:
     uint32_t getOperatorID() { return physicalOperatorID++; }
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
+    // Shares the bloom filters of the already mapped BloomFilterProbe operators with the build
+    // sides of a join. sharedStates are indexed by build idx.
+    void mapBloomFilterProbes(const std::vector<planner::LogicalOperator*>& probes,
+        const std::vector<std::shared_ptr<HashJoinSharedState>>& sharedStates);
 
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
@@ -118,6 +118,8 @@ public:
     void mergeMayContainNulls(FactorizedTable& other);
     void merge(FactorizedTable& other);
 
+    storage::MemoryManager* getMemoryManager() const { return memoryManager; }
+
     common::InMemOverflowBuffer* getInMemOverflowBuffer() const {
         return inMemOverflowBuffer.get();
     }
@@ -240,6 +242,11 @@ public:
 
     void getNextFlatTuple();
 
+    // Scans up to maxNumTuples of the next tuples into unflat vectors and moves the iterator past
+    // them. Only valid if the table has no unflat columns. Returns the number of tuples scanned.
+    uint64_t scanNextFlatTuples(std::vector<common::ValueVector*>& vectors,
+        uint64_t maxNumTuples);
+
     void resetState();
 
 private:
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace processor {
+
+// Bounded queue through which result collectors hand chunks of a streamed query result to the
+// consumer. Producers block while the queue is full, so the memory held by a streamed result is
+// bounded by the queue capacity plus one chunk per producing thread.
+class ResultChunkQueue {
+public:
+    static constexpr uint64_t DEFAULT_CAPACITY = 4;
+
+    explicit ResultChunkQueue(uint64_t capacity = DEFAULT_CAPACITY) : capacity{capacity} {}
+
+    // Blocks while the queue is full. Throws an InterruptException if the query is interrupted
+    // or the consumer closes the queue in the meantime.
+    void push(std::unique_ptr<FactorizedTable> chunk, main::ClientContext* clientContext);
+    // Called once all producers are done. A non-null error is rethrown to the consumer after the
+    // remaining chunks are popped.
+    void finishProducing(std::exception_ptr error);
+
+    // Blocks until a chunk is available. Returns nullptr once the queue is closed or drained
+    // after producing finished.
+    std::unique_ptr<FactorizedTable> pop();
+    // Discards buffered chunks and wakes up blocked producers.
+    void close();
+
+    bool isExhausted() const;
+    bool hasError() const;
+
+private:
+    uint64_t capacity;
+    mutable std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<FactorizedTable>> chunks;
+    bool producingFinished = false;
+    bool closed = false;
+    std::exception_ptr error = nullptr;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -77,6 +77,8 @@ public:
     uint8_t* getFrame(common::page_idx_t pageIdx);
     PageState* getPageState(common::page_idx_t pageIdx) { return &pageStates[pageIdx]; }
 
+    // Thread-safe: new pages are added under the exclusive file handle lock, and page states and
+    // frame groups are never reallocated, so pages can be added while others are being read.
     common::page_idx_t addNewPage();
     common::page_idx_t addNewPages(common::page_idx_t numNewPages);
     void removePageIdxAndTruncateIfNecessary(common::page_idx_t pageIdx);
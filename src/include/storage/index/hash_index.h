@@ -1,7 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include <type_traits>
 
@@ -35,6 +37,7 @@ class DiskArrayCollection;
 class OnDiskHashIndex {
 public:
     virtual ~OnDiskHashIndex() = default;
+    virtual bool hasUpdates() const = 0;
     virtual bool checkpoint() = 0;
     virtual bool checkpointInMemory() = 0;
     virtual bool rollbackInMemory() = 0;
@@ -84,6 +87,11 @@ public:
     // - the key is neither deleted nor found in the local storage, lookup in the persistent
     // storage.
     bool lookupInternal(const transaction::Transaction* transaction, Key key,
+        common::offset_t& result, visible_func isVisible) {
+        return lookupInternal(transaction, key, HashIndexUtils::hash(key), result, isVisible);
+    }
+    // Same as above, but with the hash of the key already computed by the caller.
+    bool lookupInternal(const transaction::Transaction* transaction, Key key, common::hash_t hash,
         common::offset_t& result, visible_func isVisible) {
         KU_ASSERT(transaction->getType() != transaction::TransactionType::CHECKPOINT);
         auto localLookupState = localStorage->lookup(key, result, isVisible);
@@ -94,7 +102,14 @@ public:
             return true;
         }
         KU_ASSERT(localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST);
-        return lookupInPersistentIndex(transaction, key, result, isVisible);
+        return lookupInPersistentIndex(transaction, key, hash, result, isVisible);
+    }
+
+    // Returns the primary slot the given hash maps to in the persistent index. Used to order
+    // batched lookups so that lookups into the same slot pages are performed consecutively.
+    slot_id_t getPrimarySlotIdForHash(const transaction::Transaction* transaction,
+        common::hash_t hash) const {
+        return HashIndexUtils::getPrimarySlotIdForHash(getHeader(transaction), hash);
     }
 
     // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
@@ -146,47 +161,91 @@ public:
         }
     }
 
+    bool hasUpdates() const override { return localStorage->hasUpdates(); }
     bool checkpoint() override;
     bool checkpointInMemory() override;
     bool rollbackInMemory() override;
     inline FileHandle* getFileHandle() const { return fileHandle; }
 
 private:
+    const HashIndexHeader& getHeader(const transaction::Transaction* transaction) const {
+        return transaction->getType() == transaction::TransactionType::CHECKPOINT ?
+                   this->indexHeaderForWriteTrx :
+                   this->indexHeaderForReadTrx;
+    }
+
     bool lookupInPersistentIndex(const transaction::Transaction* transaction, Key key,
         common::offset_t& result, visible_func isVisible) {
-        auto& header = transaction->getType() == transaction::TransactionType::CHECKPOINT ?
-                           this->indexHeaderForWriteTrx :
-                           this->indexHeaderForReadTrx;
+        return lookupInPersistentIndex(transaction, key, HashIndexUtils::hash(key), result,
+            isVisible);
+    }
+    // Slots are probed in place through the optimistic read protocol of the buffer manager. Only
+    // the entries whose fingerprints match are copied out of the frame, and keys are compared
+    // (which for strings may require reading from the overflow file) after the read is validated.
+    bool lookupInPersistentIndex(const transaction::Transaction* transaction, Key key,
+        common::hash_t hashValue, common::offset_t& result, visible_func isVisible) {
+        auto& header = getHeader(transaction);
         // There may not be any primary key slots if we try to lookup on an empty index
         if (header.numEntries == 0) {
             return false;
         }
-        auto hashValue = HashIndexUtils::hash(key);
         auto fingerprint = HashIndexUtils::getFingerprintForHash(hashValue);
-        auto iter = getSlotIterator(HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
-            transaction);
-        do {
-            auto entryPos =
-                findMatchedEntryInSlot(transaction, iter.slot, key, fingerprint, isVisible);
-            if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
-                result = iter.slot.entries[entryPos].value;
-                return true;
+        SlotInfo slotInfo{HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
+            SlotType::PRIMARY};
+        SlotCandidates candidates;
+        while (true) {
+            readSlotCandidates(transaction, slotInfo, fingerprint, candidates);
+            for (auto i = 0u; i < candidates.numEntries; i++) {
+                const auto& entry = candidates.entries[i];
+                if (equals(transaction, key, entry.key) && isVisible(entry.value)) {
+                    result = entry.value;
+                    return true;
+                }
             }
-        } while (nextChainedSlot(transaction, iter));
-        return false;
+            if (candidates.nextOvfSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID) {
+                return false;
+            }
+            KU_ASSERT(slotInfo.slotType == SlotType::PRIMARY ||
+                      slotInfo.slotId != candidates.nextOvfSlotId);
+            slotInfo = SlotInfo{candidates.nextOvfSlotId, SlotType::OVF};
+        }
+    }
+
+    // Entries of a slot whose fingerprints match the key being looked up.
+    struct SlotCandidates {
+        entry_pos_t numEntries = 0;
+        std::array<SlotEntry<T>, getSlotCapacity<T>()> entries;
+        slot_id_t nextOvfSlotId = SlotHeader::INVALID_OVERFLOW_SLOT_ID;
+    };
+
+    void readSlotCandidates(const transaction::Transaction* transaction, const SlotInfo& slotInfo,
+        uint8_t fingerprint, SlotCandidates& candidates) const {
+        auto& slots = slotInfo.slotType == SlotType::PRIMARY ? *pSlots : *oSlots;
+        slots.readInPlace(slotInfo.slotId, transaction, [&](const Slot<T>& slot) {
+            // May be invoked multiple times if the optimistic read is retried.
+            candidates.numEntries = 0;
+            auto mask = slot.header.getMatchingFingerprintMask(fingerprint);
+            while (mask != 0) {
+                candidates.entries[candidates.numEntries++] = slot.entries[std::countr_zero(mask)];
+                mask &= mask - 1;
+            }
+            candidates.nextOvfSlotId = slot.header.nextOvfSlotId;
+        });
     }
+
     void deleteFromPersistentIndex(const transaction::Transaction* transaction, Key key,
         visible_func isVisible);
 
     entry_pos_t findMatchedEntryInSlot(const transaction::Transaction* transaction,
         const Slot<T>& slot, Key key, uint8_t fingerprint, const visible_func& isVisible) const {
-        for (auto entryPos = 0u; entryPos < getSlotCapacity<T>(); entryPos++) {
-            if (slot.header.isEntryValid(entryPos) &&
-                slot.header.fingerprints[entryPos] == fingerprint &&
-                equals(transaction, key, slot.entries[entryPos].key) &&
+        auto mask = slot.header.getMatchingFingerprintMask(fingerprint);
+        while (mask != 0) {
+            const auto entryPos = static_cast<entry_pos_t>(std::countr_zero(mask));
+            if (equals(transaction, key, slot.entries[entryPos].key) &&
                 isVisible(slot.entries[entryPos].value)) {
                 return entryPos;
             }
+            mask &= mask - 1;
         }
         return SlotHeader::INVALID_ENTRY_POS;
     }
@@ -332,6 +391,14 @@ public:
 
     bool lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result, visible_func isVisible);
+    // Batched lookup of the keys at the given positions of keyVector. results[i] receives the
+    // offset of the key at positions[i], or INVALID_OFFSET if it is not found; entries of results
+    // which are not INVALID_OFFSET on entry are considered resolved and are skipped. Keys are
+    // hashed once and looked up in the order of their hash index and primary slot, so that
+    // lookups touching the same slot pages are performed back to back.
+    void lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results,
+        visible_func isVisible);
 
     inline bool insert(const transaction::Transaction* transaction, common::ku_string_t key,
         common::offset_t value, visible_func isVisible) {
@@ -378,7 +445,7 @@ public:
     void delete_(common::ValueVector* keyVector);
 
     void checkpointInMemory();
-    void checkpoint();
+    void checkpoint(main::ClientContext* context);
     FileHandle* getFileHandle() const { return fileHandle; }
     OverflowFile* getOverflowFile() const { return overflowFile.get(); }
 
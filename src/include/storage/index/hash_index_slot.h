@@ -46,6 +46,16 @@ public:
 
     inline entry_pos_t numEntries() const { return std::popcount(validityMask); }
 
+    // Returns a mask of the valid entries whose fingerprint matches the given one. The comparison
+    // loop is branch-free so that it can be vectorized.
+    inline uint32_t getMatchingFingerprintMask(uint8_t fingerprint) const {
+        uint32_t mask = 0;
+        for (auto entryPos = 0u; entryPos < FINGERPRINT_CAPACITY; entryPos++) {
+            mask |= static_cast<uint32_t>(fingerprints[entryPos] == fingerprint) << entryPos;
+        }
+        return mask & validityMask;
+    }
+
 public:
     std::array<uint8_t, FINGERPRINT_CAPACITY> fingerprints;
     uint32_t validityMask;
@@ -40,7 +40,7 @@ public:
     NodeGroupCollection& getNodeGroups() { return nodeGroups; }
 
     bool lookupPK(const transaction::Transaction* transaction, const common::ValueVector* keyVector,
-        common::offset_t& result);
+        common::sel_t pos, common::offset_t& result);
 
 private:
     void initLocalHashIndex();
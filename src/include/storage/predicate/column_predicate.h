@@ -20,7 +20,7 @@ public:
     }
     bool isEmpty() const { return predicates.empty(); }
 
-    common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata);
+    common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata) const;
 
     std::string toString() const;
 
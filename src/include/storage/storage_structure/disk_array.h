@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
@@ -9,6 +10,7 @@
 #include "common/constants.h"
 #include "common/copy_constructors.h"
 #include "common/types/types.h"
+#include "storage/file_handle.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_utils.h"
 #include "transaction/transaction.h"
@@ -110,6 +112,22 @@ public:
         transaction::TransactionType trxType = transaction::TransactionType::READ_ONLY);
 
     void get(uint64_t idx, const transaction::Transaction* transaction, std::span<std::byte> val);
+    // Runs readOp on the element at idx directly inside the page frame, without copying the whole
+    // element out first. Under the optimistic read protocol readOp may be invoked more than once
+    // (and on a frame which is concurrently being modified), so it must only read from the
+    // element and reset any state it produces on each invocation.
+    template<typename Func>
+    void readInPlace(uint64_t idx, const transaction::Transaction* transaction, Func&& readOp) {
+        std::shared_lock sLck{diskArraySharedMtx};
+        auto location = locateElementNoLock(idx, transaction);
+        auto readElement = [&](const uint8_t* frame) { readOp(frame + location.offsetInPage); };
+        if (location.readShadowPage) {
+            ShadowUtils::readShadowVersionOfPage(fileHandle, location.pageIdx, *shadowFile,
+                readElement);
+        } else {
+            fileHandle.optimisticReadPage(location.pageIdx, readElement);
+        }
+    }
 
     // Note: This function is to be used only by the WRITE trx.
     void update(const transaction::Transaction* transaction, uint64_t idx,
@@ -222,6 +240,14 @@ protected:
     virtual void checkpointOrRollbackInMemoryIfNecessaryNoLock(bool isCheckpoint);
 
 private:
+    struct ElementLocation {
+        common::page_idx_t pageIdx;
+        uint32_t offsetInPage;
+        // The checkpoint transaction reads the shadow version of pages it has updated.
+        bool readShadowPage;
+    };
+    ElementLocation locateElementNoLock(uint64_t idx, const transaction::Transaction* transaction);
+
     bool checkOutOfBoundAccess(transaction::TransactionType trxType, uint64_t idx) const;
     bool hasPIPUpdatesNoLock(uint64_t pipIdx);
 
@@ -288,6 +314,14 @@ public:
         return val;
     }
 
+    // See DiskArrayInternal::readInPlace.
+    template<typename Func>
+    inline void readInPlace(uint64_t idx, const transaction::Transaction* transaction,
+        Func&& readOp) {
+        diskArray.readInPlace(idx, transaction,
+            [&](const uint8_t* element) { readOp(*reinterpret_cast<const U*>(element)); });
+    }
+
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(const transaction::Transaction* transaction, uint64_t newNumElements) {
         U defaultVal;
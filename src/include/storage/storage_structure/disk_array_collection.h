@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 
 #include "common/constants.h"
 #include "common/types/types.h"
@@ -11,6 +12,9 @@ namespace storage {
 
 class FileHandle;
 
+// Each DiskArray only writes to its own header, which is allocated when the collection is
+// constructed, so disk arrays of the same collection can be updated and checkpointed
+// concurrently. Changes to the header pages themselves are serialized by the collection's mutex.
 class DiskArrayCollection {
     struct HeaderPage {
         explicit HeaderPage(uint32_t numHeaders = 0)
@@ -34,6 +38,7 @@ public:
     void checkpoint();
 
     void checkpointInMemory() {
+        std::unique_lock lck{mtx};
         for (size_t i = 0; i < headersForWriteTrx.size(); i++) {
             *headersForReadTrx[i] = *headersForWriteTrx[i];
         }
@@ -64,6 +69,7 @@ private:
     // List of indices used to store old header pages.
     std::vector<common::page_idx_t> headerPageIndices;
     uint64_t numHeaders;
+    std::mutex mtx;
 };
 
 } // namespace storage
@@ -163,6 +163,11 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<ChunkedCSRHeader> oldHeader;
     std::unique_ptr<ChunkedCSRHeader> newHeader;
+    // Whether CSR lists are written sorted by neighbour offset.
+    bool sortByNbrOffset = false;
+    // Merging in-memory insertions into the persistent CSR is deferred while they are no more than
+    // this ratio of the persistent rows, including gaps left for insertions. 0 always merges.
+    double deltaMergeRatio = 0;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<std::unique_ptr<Column>> columns, FileHandle& dataFH, MemoryManager* mm,
@@ -181,6 +186,11 @@ static constexpr common::column_id_t REL_ID_COLUMN_ID = 1;
 // Transient data are organized similar to normal node groups. Tuples are always appended to the end
 // of `chunkedGroups`. We keep an extra csrIndex to track the vector of row indices for each bound
 // node.
+// Transient data act as a delta on top of the persistent CSR. If it only consists of insertions and
+// is small relative to the persistent data, a checkpoint flushes the rows appended since the last
+// checkpoint as a new delta run, instead of rewriting the CSR regions. Delta runs and the csrIndex
+// are serialized, and loaded back into `chunkedGroups` when the database is opened. All of them are
+// merged into the persistent CSR once the delta grows beyond the merge ratio.
 struct RelTableScanState;
 class CSRNodeGroup final : public NodeGroup {
 public:
@@ -202,6 +212,10 @@ public:
 
     void initializeScanState(transaction::Transaction* transaction, TableScanState& state) override;
     NodeGroupScanResult scan(transaction::Transaction* transaction, TableScanState& state) override;
+    // Returns the number of rels of a bound node that are visible to the transaction. Only the CSR
+    // header and version info are read, neighbour and property columns are not scanned.
+    common::row_idx_t countRels(transaction::Transaction* transaction,
+        RelTableScanState& relScanState, common::offset_t boundOffsetInGroup);
 
     void appendChunkedCSRGroup(const transaction::Transaction* transaction,
         ChunkedCSRNodeGroup& chunkedGroup);
@@ -229,6 +243,10 @@ public:
     }
 
     void serialize(common::Serializer& serializer) override;
+    void deserializeDeltaRuns(MemoryManager& memoryManager, common::Deserializer& deSer);
+    // Loads the rows of delta runs into memory. Should be called once after deserialization.
+    void loadDeltaRuns(MemoryManager& memoryManager,
+        const std::vector<std::unique_ptr<Column>>& columns);
 
 private:
     void initScanForCommittedPersistent(transaction::Transaction* transaction,
@@ -258,6 +276,12 @@ private:
     void checkpointInMemOnly(const common::UniqLock& lock, NodeGroupCheckpointState& state);
     void checkpointInMemAndOnDisk(const common::UniqLock& lock, NodeGroupCheckpointState& state);
 
+    bool canDeferMerge(const common::UniqLock& lock, const CSRNodeGroupCheckpointState& csrState);
+    // Flushes in-memory rows that are not in any delta run yet as a new delta run.
+    void checkpointDeltaRun(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState);
+    common::row_idx_t getNumRowsInDeltaRuns() const;
+
     void populateCSRLengthInMemOnly(const common::UniqLock& lock, common::offset_t numNodes,
         const CSRNodeGroupCheckpointState& csrState);
 
@@ -285,17 +309,32 @@ private:
     static bool isWithinDensityBound(const ChunkedCSRHeader& header,
         const std::vector<CSRRegion>& leafRegions, const CSRRegion& region);
 
+    // Returns the in-memory rows of a node in the order they are checkpointed. Invalid rows are
+    // kept at the end of the result.
+    row_idx_vec_t getInMemRowsToCheckpoint(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState, common::offset_t nodeOffset);
+    common::offset_t getInMemNbrOffset(const common::UniqLock& lock, common::row_idx_t row);
+    // For each row written to the region, whether it comes from persistent data (true) or from
+    // in-memory insertions (false). Used to merge both sorted by neighbour offset.
+    std::vector<bool> computeMergeOrderInRegion(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region);
+
+    // `mergeOrders` holds the merge order of each region, or is empty if persistent rows of a node
+    // are written before its in-memory rows.
     void checkpointColumn(const common::UniqLock& lock, common::column_id_t columnID,
-        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions);
+        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+        const std::vector<std::vector<bool>>& mergeOrders);
     ChunkCheckpointState checkpointColumnInRegion(const common::UniqLock& lock,
         common::column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
-        const CSRRegion& region);
+        const CSRRegion& region, const std::vector<bool>& mergeOrder);
     void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const;
     void finalizeCheckpoint(const common::UniqLock& lock);
 
 private:
     std::unique_ptr<ChunkedNodeGroup> persistentChunkGroup;
     std::unique_ptr<CSRIndex> csrIndex;
+    // On-disk copies of consecutive in-memory rows, starting from row 0.
+    std::vector<std::unique_ptr<ChunkedNodeGroup>> deltaRuns;
 };
 
 } // namespace storage
@@ -14,13 +14,13 @@ public:
 
     void scan(transaction::Transaction* transaction, const ChunkState& state,
         DictionaryChunk& dictChunk) const;
-    // Offsets to scan should be a sorted list of pairs mapping the index of the entry in the string
+    // Offsets to scan should be a list of pairs mapping the index of the entry in the string
     // dictionary (as read from the index column) to the output index in the result vector to store
     // the string.
     void scan(transaction::Transaction* transaction, const ChunkState& offsetState,
         const ChunkState& dataState,
         std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
-        common::ValueVector* resultVector, const ColumnChunkMetadata& indexMeta);
+        common::ValueVector* resultVector);
 
     DictionaryChunk::string_index_t append(const DictionaryChunk& dictChunk, ChunkState& state,
         std::string_view val);
@@ -32,6 +32,8 @@ public:
     Column* getOffsetColumn() const { return offsetColumn.get(); }
 
 private:
+    static constexpr uint64_t INVALID_SCANNED_POS = UINT64_MAX;
+
     void scanOffsets(transaction::Transaction* transaction, const ChunkState& state,
         DictionaryChunk::string_offset_t* offsets, uint64_t index, uint64_t numValues,
         uint64_t dataSize);
@@ -103,6 +103,11 @@ public:
 
     bool scanInternal(transaction::Transaction* transaction, TableScanState& scanState) override;
     bool lookup(transaction::Transaction* transaction, const TableScanState& scanState) const;
+    // Looks up all selected node IDs under a single lock of the node group of the scan state, one
+    // row at a time. The node IDs must be non-null and in that node group. Returns false if any
+    // row is not visible to the transaction; the outputs of such rows are left untouched.
+    bool lookupMultiple(transaction::Transaction* transaction,
+        const TableScanState& scanState) const;
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(const transaction::Transaction* transaction,
@@ -120,6 +125,10 @@ public:
 
     bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result) const;
+    // Batched version of lookupPK. results[i] receives the offset of the key at positions[i], or
+    // INVALID_OFFSET if the key doesn't exist.
+    void lookupPKs(const transaction::Transaction* transaction, common::ValueVector* keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results) const;
     template<common::IndexHashable T>
     size_t appendPKWithIndexPos(const transaction::Transaction* transaction,
         const IndexBuffer<T>& buffer, uint64_t bufferOffset, uint64_t indexPos) {
@@ -147,7 +156,8 @@ public:
         transaction::Transaction* transaction, ChunkedNodeGroup& chunkedGroup);
 
     void commit(transaction::Transaction* transaction, LocalTable* localTable) override;
-    void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) override;
+    void checkpoint(main::ClientContext* context, common::Serializer& ser,
+        catalog::TableCatalogEntry* tableEntry) override;
 
     common::node_group_idx_t getNumCommittedNodeGroups() const {
         return nodeGroups->getNumNodeGroups();
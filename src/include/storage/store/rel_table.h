@@ -134,6 +134,11 @@ public:
     void initScanState(transaction::Transaction* transaction, TableScanState& scanState) override;
 
     bool scanInternal(transaction::Transaction* transaction, TableScanState& scanState) override;
+    // Returns the number of rels of the bound node in the direction of the scan state, including
+    // uncommitted ones if the state has a local table. Neighbour and property columns are not
+    // scanned.
+    common::row_idx_t countRels(transaction::Transaction* transaction,
+        RelTableScanState& relScanState, common::offset_t boundNodeOffset) const;
 
     void insert(transaction::Transaction* transaction, TableInsertState& insertState) override;
     void update(transaction::Transaction* transaction, TableUpdateState& updateState) override;
@@ -167,7 +172,8 @@ public:
         common::RelDataDirection direction) const;
 
     void commit(transaction::Transaction* transaction, LocalTable* localTable) override;
-    void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) override;
+    void checkpoint(main::ClientContext* context, common::Serializer& ser,
+        catalog::TableCatalogEntry* tableEntry) override;
 
     common::row_idx_t getNumRows() override { return nextRelOffset; }
 
@@ -66,7 +66,8 @@ public:
         return numRows;
     }
 
-    void checkpoint(const std::vector<common::column_id_t>& columnIDs);
+    void checkpoint(const std::vector<common::column_id_t>& columnIDs, bool sortByNbrOffset,
+        double deltaMergeRatio);
 
     void serialize(common::Serializer& serializer) const;
 
@@ -169,7 +169,8 @@ public:
     void dropColumn() { setHasChanges(); }
 
     virtual void commit(transaction::Transaction* transaction, LocalTable* localTable) = 0;
-    virtual void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) = 0;
+    virtual void checkpoint(main::ClientContext* context, common::Serializer& ser,
+        catalog::TableCatalogEntry* tableEntry) = 0;
 
     virtual common::row_idx_t getNumRows() = 0;
 
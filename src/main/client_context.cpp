@@ -10,11 +10,14 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/statement_cache.h"
+#include "main/streaming_execution.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -68,9 +71,14 @@ ClientContext::ClientContext(Database* database)
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
+    clientConfig.streamResults = ClientConfigDefault::STREAM_RESULTS;
 }
 
-ClientContext::~ClientContext() = default;
+ClientContext::~ClientContext() {
+    if (const auto stream = activeStream.lock()) {
+        stream->finish();
+    }
+}
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
     KU_ASSERT(hasTimeout());
@@ -93,6 +101,11 @@ uint64_t ClientContext::getQueryTimeOut() const {
     return clientConfig.timeoutInMS;
 }
 
+void ClientContext::setStreamResults(bool streamResults) {
+    lock_t lck{mtx};
+    clientConfig.streamResults = streamResults;
+}
+
 void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
     lock_t lck{mtx};
     clientConfig.numThreads = numThreads;
@@ -241,9 +254,11 @@ std::string ClientContext::getEnvVariable(const std::string& name) {
 
 std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query) {
     std::unique_lock<std::mutex> lck{mtx};
+    finishActiveStreamNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
+    bool statementCacheHit = false;
     try {
-        parsedStatements = parseQuery(query);
+        parsedStatements = parseQuery(query, &statementCacheHit);
     } catch (std::exception& exception) {
         return preparedStatementWithError(exception.what());
     }
@@ -251,7 +266,9 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
         return preparedStatementWithError(
             "Connection Exception: We do not support prepare multiple statements.");
     }
-    return prepareNoLock(parsedStatements[0]);
+    auto preparedStatement = prepareNoLock(parsedStatements[0]);
+    setStatementCacheSummary(preparedStatement->preparedSummary, statementCacheHit);
+    return preparedStatement;
 }
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatement,
@@ -263,9 +280,11 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans, std::optional<uint64_t> queryID) {
     lock_t lck{mtx};
+    finishActiveStreamNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
+    bool statementCacheHit = false;
     try {
-        parsedStatements = parseQuery(query);
+        parsedStatements = parseQuery(query, &statementCacheHit);
     } catch (std::exception& exception) {
         return queryResultWithError(exception.what());
     }
@@ -274,7 +293,12 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID);
+        setStatementCacheSummary(preparedStatement->preparedSummary, statementCacheHit);
+        // Executing a statement buffers the rest of the previous streamed result, so only the
+        // result of the last statement is worth streaming.
+        const auto isLastStatement = statement == parsedStatements.back();
+        auto currentQueryResult =
+            executeNoLock(preparedStatement.get(), 0u, queryID, isLastStatement);
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -340,6 +364,8 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
         preparedStatement->statementResult =
             std::make_unique<BoundStatementResult>(boundStatement->getStatementResult()->copy());
         // planning
+        auto planningTimer = TimeMetric(true /* enable */);
+        planningTimer.start();
         auto planner = Planner(this);
         std::vector<std::unique_ptr<LogicalPlan>> plans;
         if (enumerateAllPlans) {
@@ -351,6 +377,8 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
         for (auto& plan : plans) {
             optimizer::Optimizer::optimize(plan.get(), this);
         }
+        planningTimer.stop();
+        preparedStatement->preparedSummary.planningTime = planningTimer.getElapsedTimeMS();
         if (!encodedJoin.empty()) {
             std::unique_ptr<LogicalPlan> match;
             for (auto& plan : plans) {
@@ -379,12 +407,38 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     return preparedStatement;
 }
 
-std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_view query) {
+void ClientContext::setStatementCacheSummary(PreparedSummary& summary,
+    bool statementCacheHit) const {
+    const auto statementCache = localDatabase->statementCache.get();
+    summary.statementCacheHit = statementCacheHit;
+    summary.statementCacheNumHits = statementCache->getNumHits();
+    summary.statementCacheNumMisses = statementCache->getNumMisses();
+}
+
+std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_view query,
+    bool* statementCacheHit) {
     if (query.empty()) {
         throw ConnectionException("Query is empty.");
     }
     std::vector<std::shared_ptr<Statement>> statements;
     bool startNewTrx = !transactionContext->hasActiveTransaction();
+    // Statements parsed inside a manual transaction may depend on uncommitted schema changes that
+    // can still be rolled back, and remote catalogs are not versioned, so neither is cached.
+    const auto useCache = startNewTrx && remoteDatabase == nullptr;
+    auto statementCache = localDatabase->statementCache.get();
+    std::string cacheKey;
+    uint64_t catalogVersion = 0;
+    if (useCache) {
+        cacheKey = StatementCache::normalize(query);
+        catalogVersion = localDatabase->catalog->getVersion();
+        statements = statementCache->lookup(cacheKey, catalogVersion);
+        if (!statements.empty()) {
+            if (statementCacheHit) {
+                *statementCacheHit = true;
+            }
+            return statements;
+        }
+    }
     if (startNewTrx) {
         transactionContext->beginAutoTransaction(true /* readOnlyStatement */);
     }
@@ -399,6 +453,9 @@ std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_vi
     if (startNewTrx) {
         transactionContext->commit();
     }
+    if (useCache) {
+        statementCache->insert(std::move(cacheKey), statements, catalogVersion);
+    }
     return statements;
 }
 
@@ -419,6 +476,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
                                        // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishActiveStreamNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -431,7 +489,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID);
+    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID, true /* allowStreaming */);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -450,7 +508,7 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
 }
 
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
-    uint32_t planIdx, std::optional<uint64_t> queryID) {
+    uint32_t planIdx, std::optional<uint64_t> queryID, bool allowStreaming) {
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -478,6 +536,24 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     }
     auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
     profiler->enabled = preparedStatement->isProfile();
+    auto sResult = preparedStatement->statementResult.get();
+    if (allowStreaming && canStreamResult(preparedStatement, physicalPlan.get())) {
+        auto resultCollector = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get());
+        // Every worker of the root pipeline can hand over a chunk without waiting on the others.
+        auto chunkQueue = std::make_shared<ResultChunkQueue>(
+            std::max(ResultChunkQueue::DEFAULT_CAPACITY, clientConfig.numThreads));
+        resultCollector->streamResultTo(chunkQueue);
+        auto resultFT = resultCollector->getResultFactorizedTable();
+        auto stream = std::make_shared<StreamingExecution>(this,
+            localDatabase->queryProcessor.get(), std::move(physicalPlan), std::move(profiler),
+            std::move(executionContext), std::move(chunkQueue));
+        stream->start();
+        activeStream = stream;
+        queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
+        queryResult->initResultTableAndIterator(std::move(resultFT));
+        queryResult->streamingExecution = std::move(stream);
+        return queryResult;
+    }
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -502,16 +578,35 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
         [](auto& spiller) { spiller.clearFile(); });
     executingTimer.stop();
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
-    auto sResult = preparedStatement->statementResult.get();
     queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
     queryResult->initResultTableAndIterator(std::move(resultFT));
 
     return queryResult;
 }
 
+bool ClientContext::canStreamResult(PreparedStatement* preparedStatement,
+    PhysicalPlan* physicalPlan) const {
+    // Only plain read-only queries are streamed. Profiling needs the complete execution and
+    // statements with side effects must be done when the result is returned.
+    if (!clientConfig.streamResults ||
+        preparedStatement->getStatementType() != StatementType::QUERY ||
+        !preparedStatement->isReadOnly() || preparedStatement->isProfile()) {
+        return false;
+    }
+    return ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get())->canStreamResult();
+}
+
+void ClientContext::finishActiveStreamNoLock() {
+    if (const auto stream = activeStream.lock()) {
+        stream->bufferRemainingChunks();
+    }
+    activeStream.reset();
+}
+
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
+    finishActiveStreamNoLock();
     // check if we are on AutoCommit. In this case we should start a transaction
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
@@ -562,6 +657,7 @@ void ClientContext::runQuery(std::string query) {
     // Currently, we split multiple query statements into single query and execute them one by one,
     // each with an auto transaction. The correct way is to execute them in one transaction. But we
     // do not support DDL and copy in one Tx.
+    finishActiveStreamNoLock();
     if (transactionContext->hasActiveTransaction()) {
         transactionContext->commit();
     }
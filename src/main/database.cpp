@@ -14,6 +14,7 @@
 #include "common/file_system/virtual_file_system.h"
 #include "extension/extension.h"
 #include "main/db_config.h"
+#include "main/statement_cache.h"
 #include "processor/processor.h"
 #include "storage/storage_extension.h"
 #include "storage/storage_manager.h"
@@ -90,6 +91,7 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     StorageManager::recover(clientContext);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
     databaseManager = std::make_unique<DatabaseManager>();
+    statementCache = std::make_unique<StatementCache>();
 }
 
 Database::~Database() {
@@ -22,14 +22,16 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskFileSetting),
-    GET_CONFIGURATION(EnableGDSSetting)};
+    GET_CONFIGURATION(EnableGDSSetting), GET_CONFIGURATION(StreamResultsSetting),
+    GET_CONFIGURATION(RelDeltaMergeRatioSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
       autoCheckpoint{systemConfig.autoCheckpoint},
-      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true} {}
+      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true},
+      relDeltaMergeRatio{0} {}
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
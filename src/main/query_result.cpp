@@ -2,6 +2,7 @@
 
 #include "common/arrow/arrow_converter.h"
 #include "common/exception/runtime.h"
+#include "main/streaming_execution.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -42,7 +43,8 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
-    return factorizedTable->getTotalNumFlatTuples();
+    fetchRemainingChunks();
+    return numTuplesInConsumedChunks + factorizedTable->getTotalNumFlatTuples();
 }
 
 QuerySummary* QueryResult::getQuerySummary() const {
@@ -50,6 +52,10 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    if (numTuplesInConsumedChunks > 0) {
+        throw RuntimeException("Cannot reset the iterator of a streamed query result after part of "
+                               "it has been consumed.");
+    }
     iterator->resetState();
 }
 
@@ -63,18 +69,86 @@ void QueryResult::initResultTableAndIterator(
     std::shared_ptr<processor::FactorizedTable> factorizedTable_) {
     factorizedTable = std::move(factorizedTable_);
     tuple = std::make_shared<FlatTuple>();
-    std::vector<Value*> valuesToCollect;
+    valuesToCollect.clear();
     for (auto& type : columnDataTypes) {
         auto value = std::make_unique<Value>(Value::createDefaultValue(type.copy()));
         valuesToCollect.push_back(value.get());
         tuple->addValue(std::move(value));
     }
-    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, valuesToCollect);
+}
+
+std::unique_ptr<FactorizedTable> QueryResult::pullChunk() const {
+    try {
+        return streamingExecution->getNextChunk();
+    } catch (std::exception& e) {
+        // A streamed query can fail after its result has been returned.
+        success = false;
+        errMsg = e.what();
+        throw;
+    }
+}
+
+bool QueryResult::fetchNextChunk() const {
+    if (!streamingExecution || streamExhausted) {
+        return false;
+    }
+    auto chunk = pullChunk();
+    if (chunk == nullptr) {
+        onStreamExhausted();
+        return false;
+    }
+    numTuplesInConsumedChunks += factorizedTable->getTotalNumFlatTuples();
+    factorizedTable = std::move(chunk);
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, valuesToCollect);
+    return true;
+}
+
+void QueryResult::fetchRemainingChunks() const {
+    if (!streamingExecution || streamExhausted) {
+        return;
+    }
+    while (auto chunk = pullChunk()) {
+        if (factorizedTable->isEmpty()) {
+            // The iterator of an empty table would skip the first tuple after a merge.
+            factorizedTable = std::move(chunk);
+            iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, valuesToCollect);
+        } else {
+            factorizedTable->merge(*chunk);
+        }
+    }
+    onStreamExhausted();
+}
+
+void QueryResult::onStreamExhausted() const {
+    streamExhausted = true;
+    querySummary->executionTime = streamingExecution->getExecutionTime();
 }
 
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
-    return iterator->hasNextFlatTuple();
+    while (!iterator->hasNextFlatTuple()) {
+        if (!fetchNextChunk()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QueryResult::hasUnflatColumns() const {
+    return factorizedTable != nullptr && factorizedTable->hasUnflatCol();
+}
+
+uint64_t QueryResult::scanNextFlatTuples(std::vector<ValueVector*>& vectors,
+    uint64_t maxNumTuples) {
+    if (!hasNext()) {
+        return 0;
+    }
+    return iterator->scanNextFlatTuples(vectors, maxNumTuples);
+}
+
+storage::MemoryManager* QueryResult::getMemoryManager() const {
+    return factorizedTable->getMemoryManager();
 }
 
 bool QueryResult::hasNextQueryResult() const {
@@ -137,5 +211,11 @@ std::unique_ptr<ArrowArray> QueryResult::getNextArrowChunk(int64_t chunkSize) {
     return data;
 }
 
+std::unique_ptr<ArrowArrayStream> QueryResult::getArrowArrayStream(int64_t chunkSize) {
+    auto stream = std::make_unique<ArrowArrayStream>();
+    ArrowConverter::toArrowArrayStream(*this, stream.get(), chunkSize);
+    return stream;
+}
+
 } // namespace main
 } // namespace kuzu
@@ -11,10 +11,26 @@ double QuerySummary::getCompilingTime() const {
     return preparedSummary.compilingTime;
 }
 
+double QuerySummary::getPlanningTime() const {
+    return preparedSummary.planningTime;
+}
+
 double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+bool QuerySummary::isStatementCacheHit() const {
+    return preparedSummary.statementCacheHit;
+}
+
+uint64_t QuerySummary::getNumHits() const {
+    return preparedSummary.statementCacheNumHits;
+}
+
+uint64_t QuerySummary::getNumMisses() const {
+    return preparedSummary.statementCacheNumMisses;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
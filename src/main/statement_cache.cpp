@@ -0,0 +1,108 @@
+#include "main/statement_cache.h"
+
+namespace kuzu {
+namespace main {
+
+static bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+std::string StatementCache::normalize(std::string_view query) {
+    std::string result;
+    result.reserve(query.size());
+    bool pendingSpace = false;
+    for (auto i = 0u; i < query.size(); i++) {
+        const auto c = query[i];
+        if (isWhitespace(c)) {
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            result.push_back(' ');
+            pendingSpace = false;
+        }
+        if (c == '\'' || c == '"' || c == '`') {
+            // Copy the quoted section verbatim, including backslash escapes.
+            result.push_back(c);
+            for (i++; i < query.size(); i++) {
+                result.push_back(query[i]);
+                if (query[i] == '\\' && c != '`' && i + 1 < query.size()) {
+                    result.push_back(query[++i]);
+                } else if (query[i] == c) {
+                    break;
+                }
+            }
+            continue;
+        }
+        if (c == '/' && i + 1 < query.size() && query[i + 1] == '/') {
+            // A line comment is terminated by the newline, which must therefore be kept.
+            const auto end = query.find('\n', i);
+            result.append(query.substr(i, end == std::string_view::npos ? end : end - i));
+            if (end == std::string_view::npos) {
+                break;
+            }
+            result.push_back('\n');
+            i = end;
+            continue;
+        }
+        if (c == '/' && i + 1 < query.size() && query[i + 1] == '*') {
+            const auto end = query.find("*/", i + 2);
+            const auto len = end == std::string_view::npos ? end : end + 2 - i;
+            result.append(query.substr(i, len));
+            if (end == std::string_view::npos) {
+                break;
+            }
+            i = end + 1;
+            continue;
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+StatementCache::statements_t StatementCache::lookup(const std::string& key,
+    uint64_t catalogVersion) {
+    std::unique_lock lck{mtx};
+    const auto it = index.find(key);
+    if (it == index.end() || it->second->catalogVersion != catalogVersion) {
+        numMisses.fetch_add(1, std::memory_order_relaxed);
+        return {};
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    numHits.fetch_add(1, std::memory_order_relaxed);
+    return it->second->statements;
+}
+
+void StatementCache::insert(std::string key, statements_t statements, uint64_t catalogVersion) {
+    if (capacity == 0 || statements.empty()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    const auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->statements = std::move(statements);
+        it->second->catalogVersion = catalogVersion;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    entries.push_front(Entry{std::move(key), std::move(statements), catalogVersion});
+    index.emplace(entries.front().key, entries.begin());
+    if (entries.size() > capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+void StatementCache::clear() {
+    std::unique_lock lck{mtx};
+    index.clear();
+    entries.clear();
+}
+
+uint64_t StatementCache::size() const {
+    std::unique_lock lck{mtx};
+    return entries.size();
+}
+
+} // namespace main
+} // namespace kuzu
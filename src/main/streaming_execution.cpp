@@ -0,0 +1,140 @@
+#include "main/streaming_execution.h"
+
+#include <utility>
+
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+StreamingExecution::StreamingExecution(ClientContext* clientContext,
+    QueryProcessor* queryProcessor, std::unique_ptr<PhysicalPlan> physicalPlan,
+    std::unique_ptr<Profiler> profiler, std::unique_ptr<ExecutionContext> executionContext,
+    std::shared_ptr<ResultChunkQueue> chunkQueue)
+    : clientContext{clientContext}, queryProcessor{queryProcessor},
+      physicalPlan{std::move(physicalPlan)}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)}, chunkQueue{std::move(chunkQueue)},
+      executingTimer{true /* enable */} {}
+
+StreamingExecution::~StreamingExecution() {
+    finish();
+}
+
+void StreamingExecution::start() {
+    executingTimer.start();
+    producer = std::thread([this] {
+        try {
+            queryProcessor->execute(physicalPlan.get(), executionContext.get());
+            chunkQueue->finishProducing(nullptr);
+        } catch (std::exception&) {
+            chunkQueue->finishProducing(std::current_exception());
+        }
+    });
+}
+
+std::unique_ptr<FactorizedTable> StreamingExecution::getNextChunk() {
+    std::unique_lock lck{mtx};
+    if (!finished) {
+        lck.unlock();
+        std::unique_ptr<FactorizedTable> chunk;
+        try {
+            chunk = chunkQueue->pop();
+        } catch (std::exception&) {
+            finish();
+            throw;
+        }
+        if (chunk != nullptr) {
+            return chunk;
+        }
+        finish();
+        lck.lock();
+    }
+    // The execution may have been finished by another statement on the connection, which
+    // buffers the remaining chunks.
+    if (!bufferedChunks.empty()) {
+        auto chunk = std::move(bufferedChunks.front());
+        bufferedChunks.pop_front();
+        return chunk;
+    }
+    if (bufferingError) {
+        std::rethrow_exception(std::exchange(bufferingError, nullptr));
+    }
+    if (closedEarly) {
+        throw RuntimeException("The streamed query result was closed before it was fully "
+                               "consumed because its connection was closed.");
+    }
+    return nullptr;
+}
+
+void StreamingExecution::bufferRemainingChunks() {
+    std::unique_lock lck{mtx};
+    if (finished) {
+        return;
+    }
+    try {
+        while (auto chunk = chunkQueue->pop()) {
+            bufferedChunks.push_back(std::move(chunk));
+        }
+    } catch (std::exception&) {
+        bufferingError = std::current_exception();
+    }
+    finishNoLock();
+}
+
+void StreamingExecution::finish() {
+    {
+        std::unique_lock lck{mtx};
+        if (finished) {
+            return;
+        }
+    }
+    // Ending the transaction must not race with another statement on the connection, so the
+    // client context lock is taken first, in the same order as statements that buffer the stream.
+    std::unique_lock contextLck{clientContext->mtx};
+    std::unique_lock lck{mtx};
+    finishNoLock();
+}
+
+void StreamingExecution::finishNoLock() {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    if (!chunkQueue->isExhausted()) {
+        closedEarly = true;
+        chunkQueue->close();
+        clientContext->interrupt();
+    }
+    if (producer.joinable()) {
+        producer.join();
+    }
+    executingTimer.stop();
+    const auto hasError = chunkQueue->hasError();
+    if (hasError) {
+        clientContext->getProgressBar()->endProgress(executionContext->queryID);
+    }
+    auto transactionContext = clientContext->getTransactionContext();
+    if (hasError && !closedEarly) {
+        transactionContext->rollback();
+    } else if (transactionContext->isAutoTransaction()) {
+        // Streamed queries are read-only, so an auto transaction of a result that was closed
+        // early can simply be rolled back.
+        if (closedEarly) {
+            transactionContext->rollback();
+        } else {
+            transactionContext->commit();
+        }
+    }
+    clientContext->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [](auto& spiller) { spiller.clearFile(); });
+}
+
+} // namespace main
+} // namespace kuzu
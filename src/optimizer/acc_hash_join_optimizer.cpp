@@ -9,6 +9,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "planner/operator/sip/logical_bloom_filter_probe.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 
 using namespace kuzu::common;
@@ -136,19 +137,19 @@ void HashJoinSIPOptimizer::visitHashJoin(LogicalOperator* op) {
     if (LogicalOperatorUtils::isAccHashJoin(hashJoin)) {
         return;
     }
-    if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT) {
-        return;
-    }
     if (hashJoin.getJoinType() != JoinType::INNER) {
         return;
     }
-    if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
-        return;
-    }
-    if (hashJoin.getSIPInfo().position == SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD) {
-        return;
+    if (hashJoin.getSIPInfo().position != SemiMaskPosition::PROHIBIT) {
+        if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
+            return;
+        }
+        if (hashJoin.getSIPInfo().position != SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD &&
+            tryProbeToBuildHJSIP(op)) {
+            return;
+        }
     }
-    tryProbeToBuildHJSIP(op);
+    tryBloomFilterHJSIP(op);
 }
 
 static bool subPlanContainsFilter(LogicalOperator* root) {
@@ -224,18 +225,118 @@ bool HashJoinSIPOptimizer::tryBuildToProbeHJSIP(LogicalOperator* op) {
     return true;
 }
 
-// TODO(Xiyang): we don't apply SIP from build to probe.
+// Operators through which a bloom filter probe can be pushed down, i.e. every output tuple of the
+// operator extends a single tuple of its first child, which is evaluated in the same pipeline.
+static bool canPushBloomFilterProbeThrough(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::BLOOM_FILTER_PROBE:
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::UNWIND:
+        return !LogicalOperatorUtils::isAccHashJoin(op);
+    default:
+        return false;
+    }
+}
+
+// Operators whose work is saved for every tuple a bloom filter probe below them discards.
+static bool isExpensiveForBloomFilterProbe(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::UNWIND:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Places a bloom filter probe on key as deep as possible on the probe side of join, i.e. right
+// above the operator producing the key. Returns nullptr if there is no work to save between the
+// probe and the join.
+static LogicalOperator* tryAppendBloomFilterProbe(std::shared_ptr<Expression> key,
+    uint32_t buildIdx, LogicalOperator* join) {
+    auto parent = join;
+    auto current = join->getChild(0);
+    auto hasWorkToSave = false;
+    while (canPushBloomFilterProbeThrough(*current) &&
+           current->getChild(0)->getSchema()->isExpressionInScope(*key)) {
+        hasWorkToSave |= isExpensiveForBloomFilterProbe(*current);
+        parent = current.get();
+        current = current->getChild(0);
+    }
+    if (!hasWorkToSave) {
+        return nullptr;
+    }
+    auto probe = std::make_shared<LogicalBloomFilterProbe>(std::move(key), buildIdx, current);
+    probe->computeFlatSchema();
+    parent->setChild(0, probe);
+    return probe.get();
+}
+
+// Node id joins are handled by semi masks. Bloom filters pass the build keys of the other joins to
+// the probe side, which is only worth it if the build side is selective.
+bool HashJoinSIPOptimizer::tryBloomFilterHJSIP(LogicalOperator* op) {
+    auto& hashJoin = op->cast<LogicalHashJoin>();
+    auto joinConditions = hashJoin.getJoinConditions();
+    if (joinConditions.size() != 1) {
+        return false;
+    }
+    auto probeKey = joinConditions[0].first;
+    if (probeKey->getDataType().getLogicalTypeID() == LogicalTypeID::INTERNAL_ID) {
+        return false;
+    }
+    if (!subPlanContainsFilter(hashJoin.getChild(1).get())) {
+        return false;
+    }
+    auto probe = tryAppendBloomFilterProbe(probeKey, 0 /* buildIdx */, op);
+    if (probe == nullptr) {
+        return false;
+    }
+    hashJoin.getSIPInfoUnsafe().bloomFilterProbes.push_back(probe);
+    return true;
+}
+
 void HashJoinSIPOptimizer::visitIntersect(LogicalOperator* op) {
+    if (!tryProbeToBuildIntersectSIP(op)) {
+        tryBloomFilterIntersectSIP(op);
+    }
+}
+
+bool HashJoinSIPOptimizer::tryBloomFilterIntersectSIP(LogicalOperator* op) {
+    auto& intersect = op->cast<LogicalIntersect>();
+    auto hasBloomFilterApplied = false;
+    for (auto i = 0u; i < intersect.getNumBuilds(); ++i) {
+        if (!subPlanContainsFilter(intersect.getChild(i + 1).get())) {
+            continue;
+        }
+        auto probe = tryAppendBloomFilterProbe(intersect.getKeyNodeID(i), i, op);
+        if (probe != nullptr) {
+            intersect.getSIPInfoUnsafe().bloomFilterProbes.push_back(probe);
+            hasBloomFilterApplied = true;
+        }
+    }
+    return hasBloomFilterApplied;
+}
+
+bool HashJoinSIPOptimizer::tryProbeToBuildIntersectSIP(LogicalOperator* op) {
     auto& intersect = op->cast<LogicalIntersect>();
     switch (intersect.getSIPInfo().position) {
     case SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD:
     case SemiMaskPosition::PROHIBIT:
-        return;
+        return false;
     default:
         break;
     }
     if (!isProbeSideQualified(op->getChild(0).get())) {
-        return;
+        return false;
     }
     auto probeRoot = intersect.getChild(0);
     auto hasSemiMaskApplied = false;
@@ -253,13 +354,14 @@ void HashJoinSIPOptimizer::visitIntersect(LogicalOperator* op) {
         }
     }
     if (!hasSemiMaskApplied) {
-        return;
+        return false;
     }
     auto& sipInfo = intersect.getSIPInfoUnsafe();
     sipInfo.position = SemiMaskPosition::ON_PROBE;
     sipInfo.dependency = SIPDependency::PROBE_DEPENDS_ON_BUILD;
     sipInfo.direction = SIPDirection::PROBE_TO_BUILD;
     intersect.setChild(0, appendAccumulate(probeRoot));
+    return true;
 }
 
 void HashJoinSIPOptimizer::visitPathPropertyProbe(LogicalOperator* op) {
@@ -0,0 +1,280 @@
+#include "optimizer/common_subexpression_eliminator.h"
+
+#include <map>
+
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void CommonSubexpressionEliminator::rewrite(LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void CommonSubexpressionEliminator::visitOperator(LogicalOperator* op) {
+    auto type = op->getOperatorType();
+    if (type != LogicalOperatorType::FILTER && type != LogicalOperatorType::PROJECTION) {
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            visitOperator(op->getChild(i).get());
+        }
+        return;
+    }
+    // A projection or filter followed by filters. Filters don't change scope, so all operators in
+    // the chain are evaluated against the same input scope.
+    std::vector<LogicalOperator*> chain{op};
+    while (chain.back()->getChild(0)->getOperatorType() == LogicalOperatorType::FILTER) {
+        chain.push_back(chain.back()->getChild(0).get());
+    }
+    auto child = chain.back()->getChild(0);
+    eliminate(chain);
+    visitOperator(child.get());
+}
+
+static expression_vector getExpressions(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::FILTER) {
+        return {op.constCast<LogicalFilter>().getPredicate()};
+    }
+    return op.constCast<LogicalProjection>().getExpressionsToProject();
+}
+
+// Children that are evaluated for every input tuple of their parent. We don't look into case
+// alternatives, lambda functions and subqueries.
+static bool canVisitChildren(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::OR:
+    case ExpressionType::XOR:
+    case ExpressionType::AND:
+    case ExpressionType::NOT:
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+    case ExpressionType::IS_NULL:
+    case ExpressionType::IS_NOT_NULL:
+    case ExpressionType::FUNCTION:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool canEliminate(const Expression& expression) {
+    if (!canVisitChildren(expression) && expression.expressionType != ExpressionType::CASE_ELSE) {
+        return false;
+    }
+    // Each call of a random function should produce a different value.
+    return !ExpressionVisitor::isRandom(expression) &&
+           !ConstantExpressionVisitor::isConstant(expression);
+}
+
+namespace {
+
+struct ExpressionInfo {
+    // The occurrence that is computed and referred to by all other occurrences. A top-level
+    // projection expression is preferred since parent operators refer to it by its unique name.
+    std::shared_ptr<Expression> expression;
+    bool isProjected = false;
+    uint64_t numOccurrences = 0;
+    // Position in chain of the lowest operator using the expression.
+    uint64_t lowestUser = 0;
+    // Number of eliminated expressions that need to be computed before this one.
+    uint64_t level = 0;
+    bool eliminate = false;
+};
+
+class ChainAnalyzer {
+public:
+    explicit ChainAnalyzer(const Schema& inputSchema) : inputSchema{inputSchema} {}
+
+    // Each occurrence of a literal has its own unique name, so equivalent expressions are matched
+    // by a key built from their structure instead.
+    std::string getKey(const Expression& expression) {
+        if (inputSchema.isExpressionInScope(expression)) {
+            return expression.getUniqueName();
+        }
+        if (expression.expressionType == ExpressionType::LITERAL) {
+            return "LITERAL(" + expression.getDataType().toString() + "," +
+                   expression.constCast<LiteralExpression>().getValue().toString() + ")";
+        }
+        if (!canVisitChildren(expression)) {
+            return expression.getUniqueName();
+        }
+        auto key = ExpressionTypeUtil::toString(expression.expressionType);
+        if (expression.expressionType == ExpressionType::FUNCTION) {
+            key += ":" + expression.constCast<ScalarFunctionExpression>().getFunction().name;
+        }
+        key += "(";
+        for (auto& child : expression.getChildren()) {
+            key += getKey(*child) + ",";
+        }
+        return key + ")" + expression.getDataType().toString();
+    }
+
+    void count(const std::shared_ptr<Expression>& expression, uint64_t position,
+        bool isProjected) {
+        if (inputSchema.isExpressionInScope(*expression)) {
+            return;
+        }
+        auto key = getKey(*expression);
+        if (!infos.contains(key)) {
+            keys.push_back(key);
+        }
+        auto& info = infos[key];
+        if (info.expression == nullptr || (isProjected && !info.isProjected)) {
+            info.expression = expression;
+            info.isProjected = isProjected;
+        }
+        info.numOccurrences++;
+        info.lowestUser = std::max(info.lowestUser, position);
+        if (canVisitChildren(*expression)) {
+            for (auto& child : expression->getChildren()) {
+                count(child, position, false /* isProjected */);
+            }
+        }
+    }
+
+    // Replace eliminated sub-expressions with the occurrence that is computed.
+    std::shared_ptr<Expression> replace(const std::shared_ptr<Expression>& expression) {
+        if (inputSchema.isExpressionInScope(*expression)) {
+            return expression;
+        }
+        auto& info = infos.at(getKey(*expression));
+        if (info.eliminate) {
+            return info.expression;
+        }
+        replaceChildren(*expression);
+        return expression;
+    }
+
+    void replaceChildren(Expression& expression) {
+        if (!canVisitChildren(expression)) {
+            return;
+        }
+        for (auto i = 0u; i < expression.getNumChildren(); ++i) {
+            expression.setChild(i, replace(expression.getChild(i)));
+        }
+    }
+
+    // Mark the outermost expressions that occur more than once.
+    void mark(const std::shared_ptr<Expression>& expression) {
+        if (inputSchema.isExpressionInScope(*expression)) {
+            return;
+        }
+        auto& info = infos.at(getKey(*expression));
+        if (info.numOccurrences > 1 && canEliminate(*expression)) {
+            info.eliminate = true;
+            return;
+        }
+        if (canVisitChildren(*expression)) {
+            for (auto& child : expression->getChildren()) {
+                mark(child);
+            }
+        }
+    }
+
+    uint64_t computeLevel(const Expression& expression) {
+        if (inputSchema.isExpressionInScope(expression) || !canVisitChildren(expression)) {
+            return 0;
+        }
+        uint64_t level = 0;
+        for (auto& child : expression.getChildren()) {
+            if (inputSchema.isExpressionInScope(*child)) {
+                continue;
+            }
+            auto childLevel = computeLevel(*child);
+            if (infos.at(getKey(*child)).eliminate) {
+                childLevel++;
+            }
+            level = std::max(level, childLevel);
+        }
+        return level;
+    }
+
+    std::vector<ExpressionInfo*> getExpressionsToEliminate() {
+        std::vector<ExpressionInfo*> result;
+        for (auto& key : keys) {
+            auto& info = infos.at(key);
+            if (info.eliminate) {
+                info.level = computeLevel(*info.expression);
+                result.push_back(&info);
+            }
+        }
+        return result;
+    }
+
+private:
+    const Schema& inputSchema;
+    std::unordered_map<std::string, ExpressionInfo> infos;
+    // Keys in the order of first occurrence, so that the rewritten plan is deterministic.
+    std::vector<std::string> keys;
+};
+
+} // namespace
+
+void CommonSubexpressionEliminator::eliminate(const std::vector<LogicalOperator*>& chain) {
+    auto analyzer = ChainAnalyzer(*chain.back()->getChild(0)->getSchema());
+    for (auto i = 0u; i < chain.size(); ++i) {
+        auto isProjection = chain[i]->getOperatorType() == LogicalOperatorType::PROJECTION;
+        for (auto& expression : getExpressions(*chain[i])) {
+            analyzer.count(expression, i, isProjection);
+        }
+    }
+    for (auto& op : chain) {
+        for (auto& expression : getExpressions(*op)) {
+            analyzer.mark(expression);
+        }
+    }
+    auto infos = analyzer.getExpressionsToEliminate();
+    if (infos.empty()) {
+        return;
+    }
+    for (auto& op : chain) {
+        if (op->getOperatorType() == LogicalOperatorType::FILTER) {
+            auto& filter = op->cast<LogicalFilter>();
+            filter.setPredicate(analyzer.replace(filter.getPredicate()));
+            continue;
+        }
+        // Parent operators refer to projected expressions, so only their children are replaced.
+        for (auto& expression : getExpressions(*op)) {
+            analyzer.replaceChildren(*expression);
+        }
+    }
+    // The computed occurrences may contain other eliminated expressions.
+    for (auto& info : infos) {
+        analyzer.replaceChildren(*info->expression);
+    }
+    // Insert projections bottom-up. Below each operator, an expression is computed by a later
+    // projection than the eliminated expressions it contains.
+    for (auto i = chain.size(); i-- > 0;) {
+        std::map<uint64_t, expression_vector> expressionsPerLevel;
+        for (auto& info : infos) {
+            if (info->lowestUser == i) {
+                expressionsPerLevel[info->level].push_back(info->expression);
+            }
+        }
+        for (auto& [_, expressions] : expressionsPerLevel) {
+            auto child = chain[i]->getChild(0);
+            auto expressionsToProject = child->getSchema()->getExpressionsInScope();
+            expressionsToProject.insert(expressionsToProject.end(), expressions.begin(),
+                expressions.end());
+            auto projection =
+                std::make_shared<LogicalProjection>(std::move(expressionsToProject), child);
+            projection->computeFlatSchema();
+            chain[i]->setChild(0, std::move(projection));
+        }
+        chain[i]->computeFlatSchema();
+    }
+}
+
+} // namespace optimizer
+} // namespace kuzu
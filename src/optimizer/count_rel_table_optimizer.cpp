@@ -0,0 +1,153 @@
+#include "optimizer/count_rel_table_optimizer.h"
+
+#include "binder/expression/aggregate_function_expression.h"
+#include "binder/expression/expression_util.h"
+#include "binder/expression/property_expression.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate/count_star.h"
+#include "planner/operator/extend/logical_count_rel_table.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void CountRelTableOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> CountRelTableOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+// The extend can be answered from the CSR header of a single rel table if it neither filters rels
+// nor nbr nodes and only outputs the rel internal id.
+static bool canCountRels(const LogicalExtend& extend) {
+    const auto& rel = *extend.getRel();
+    const auto& boundNode = *extend.getBoundNode();
+    if (extend.isRecursive() || extend.getDirection() == ExtendDirection::BOTH ||
+        rel.isMultiLabeled() || boundNode.isMultiLabeled() || rel.hasDirectionExpr()) {
+        return false;
+    }
+    for (auto& property : extend.getProperties()) {
+        if (property->getUniqueName() != rel.getInternalIDProperty()->getUniqueName()) {
+            return false;
+        }
+    }
+    for (auto& predicateSet : extend.getPropertyPredicates()) {
+        if (!predicateSet.isEmpty()) {
+            return false;
+        }
+    }
+    const auto& relEntry = rel.getSingleEntry()->constCast<RelTableCatalogEntry>();
+    const auto direction = ExtendDirectionUtil::getRelDataDirection(extend.getDirection());
+    return relEntry.getBoundTableID(direction) == boundNode.getSingleEntry()->getTableID() &&
+           extend.getNbrNode()->getTableIDsSet().contains(relEntry.getNbrTableID(direction));
+}
+
+// Each bound node must be produced at most once by the input of the extend, so that grouping by
+// the bound node counts the rels of a single node.
+static bool isNodeUnique(const LogicalOperator& op, const NodeExpression& node) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::FETCH_NODE_PROPERTY: {
+        return isNodeUnique(*op.getChild(0), node);
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        return op.constCast<LogicalScanNodeTable>().getNodeID()->getUniqueName() ==
+               node.getInternalID()->getUniqueName();
+    }
+    default:
+        return false;
+    }
+}
+
+// All keys must belong to the bound node, and one of them must identify it.
+static bool isGroupedByNode(const expression_vector& keys, const NodeExpression& node) {
+    auto hasNodeKey = false;
+    for (auto& key : keys) {
+        if (ExpressionUtil::isNodePattern(*key)) {
+            if (key->getUniqueName() != node.getUniqueName()) {
+                return false;
+            }
+            hasNodeKey = true;
+        } else if (key->expressionType == ExpressionType::PROPERTY) {
+            auto& property = key->constCast<PropertyExpression>();
+            if (property.getVariableName() != node.getUniqueName()) {
+                return false;
+            }
+            hasNodeKey |= property.isPrimaryKey() || property.isInternalID();
+        } else {
+            return false;
+        }
+    }
+    return hasNodeKey;
+}
+
+// COUNT(*), or COUNT of the nbr node or the rel, which are never null.
+static bool isRelCount(const Expression& expression, const LogicalExtend& extend) {
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    if (aggregate.isDistinct()) {
+        return false;
+    }
+    const auto& functionName = aggregate.getFunction().name;
+    if (functionName == function::CountStarFunction::name) {
+        return true;
+    }
+    if (functionName != function::CountFunction::name) {
+        return false;
+    }
+    const auto childName = aggregate.getChild(0)->getUniqueName();
+    return childName == extend.getNbrNode()->getInternalID()->getUniqueName() ||
+           childName == extend.getRel()->getInternalIDProperty()->getUniqueName();
+}
+
+std::shared_ptr<LogicalOperator> CountRelTableOptimizer::visitAggregateReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& aggregate = op->constCast<LogicalAggregate>();
+    if (aggregate.getAggregates().size() != 1) {
+        return op;
+    }
+    auto child = aggregate.getChild(0);
+    if (child->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        child = child->getChild(0);
+    }
+    if (child->getOperatorType() != LogicalOperatorType::EXTEND) {
+        return op;
+    }
+    auto& extend = child->constCast<LogicalExtend>();
+    auto boundNode = extend.getBoundNode();
+    auto countExpr = aggregate.getAggregates()[0];
+    if (!canCountRels(extend) || !isGroupedByNode(aggregate.getAllKeys(), *boundNode) ||
+        !isRelCount(*countExpr, extend) || !isNodeUnique(*extend.getChild(0), *boundNode)) {
+        return op;
+    }
+    auto countRelTable = std::make_shared<LogicalCountRelTable>(boundNode, extend.getRel(),
+        extend.getDirection(), countExpr, extend.getChild(0));
+    countRelTable->computeFlatSchema();
+    // The projection evaluates the keys, which were evaluated by the projection below the
+    // aggregate before.
+    auto expressions = aggregate.getAllKeys();
+    expressions.push_back(countExpr);
+    return std::make_shared<LogicalProjection>(std::move(expressions), std::move(countRelTable));
+}
+
+} // namespace optimizer
+} // namespace kuzu
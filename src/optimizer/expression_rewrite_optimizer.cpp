@@ -0,0 +1,357 @@
+#include "optimizer/expression_rewrite_optimizer.h"
+
+#include <limits>
+#include <utility>
+
+#include "binder/binder.h"
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "common/type_utils.h"
+#include "common/types/value/nested.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
+#include "function/cast/vector_cast_functions.h"
+#include "function/list/vector_list_functions.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void ExpressionRewriteOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> ExpressionRewriteOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+static bool isBoolLiteral(const Expression& expression, bool value) {
+    if (expression.expressionType != ExpressionType::LITERAL ||
+        expression.getDataType().getLogicalTypeID() != LogicalTypeID::BOOL) {
+        return false;
+    }
+    auto& literal = expression.constCast<LiteralExpression>();
+    return !literal.isNull() && literal.getValue().getValue<bool>() == value;
+}
+
+// The literal takes over the unique name of the expression it replaces.
+static std::shared_ptr<Expression> createLiteral(Value value, const Expression& replaced) {
+    auto result = std::make_shared<LiteralExpression>(std::move(value), replaced.getUniqueName());
+    result->setAlias(replaced.toString());
+    return result;
+}
+
+std::shared_ptr<LogicalOperator> ExpressionRewriteOptimizer::visitFilterReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto filter = op->ptrCast<LogicalFilter>();
+    auto predicate = rewriteExpression(filter->getPredicate(), *filter->getChild(0)->getSchema());
+    if (isBoolLiteral(*predicate, true)) {
+        return filter->getChild(0);
+    }
+    // A literal predicate has no data chunk to select from, so a predicate that folds to false or
+    // null is kept as is.
+    if (predicate->expressionType != ExpressionType::LITERAL) {
+        filter->setPredicate(std::move(predicate));
+    }
+    return op;
+}
+
+std::shared_ptr<LogicalOperator> ExpressionRewriteOptimizer::visitProjectionReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto projection = op->ptrCast<LogicalProjection>();
+    auto& schema = *projection->getChild(0)->getSchema();
+    expression_vector expressionsToProject;
+    for (auto& expression : projection->getExpressionsToProject()) {
+        // Parent operators refer to a projected expression by its unique name, and the data chunk
+        // it is projected into depends on the expression. So only the children are rewritten
+        // unless the whole expression is constant.
+        if (schema.isExpressionInScope(*expression)) {
+            expressionsToProject.push_back(expression);
+            continue;
+        }
+        rewriteChildren(*expression, schema);
+        if (ConstantExpressionVisitor::needFold(*expression)) {
+            expressionsToProject.push_back(foldExpression(expression));
+        } else {
+            expressionsToProject.push_back(expression);
+        }
+    }
+    projection->setExpressionsToProject(std::move(expressionsToProject));
+    return op;
+}
+
+std::shared_ptr<Expression> ExpressionRewriteOptimizer::rewriteExpression(
+    const std::shared_ptr<Expression>& expression, const Schema& schema) {
+    if (schema.isExpressionInScope(*expression)) {
+        return expression;
+    }
+    switch (expression->expressionType) {
+    case ExpressionType::LITERAL:
+        return expression;
+    case ExpressionType::PARAMETER: {
+        // The type of a parameter without value is only resolved on execution.
+        if (expression->getDataType().containsAny()) {
+            return expression;
+        }
+        return createLiteral(expression->constCast<ParameterExpression>().getValue(),
+            *expression);
+    }
+    default:
+        break;
+    }
+    rewriteChildren(*expression, schema);
+    if (ConstantExpressionVisitor::needFold(*expression)) {
+        return foldExpression(expression);
+    }
+    if (ExpressionTypeUtil::isBoolean(expression->expressionType)) {
+        auto result = simplifyBoolean(expression);
+        if (result->expressionType == ExpressionType::OR) {
+            result = rewriteDisjunctionToIn(result);
+        }
+        return result;
+    }
+    if (ExpressionTypeUtil::isComparison(expression->expressionType)) {
+        return eliminateCastInComparison(expression);
+    }
+    return expression;
+}
+
+void ExpressionRewriteOptimizer::rewriteChildren(Expression& expression, const Schema& schema) {
+    // Only rewrite children that are evaluated as plain sub-expressions, e.g. not the alternatives
+    // of a CASE or the body of a lambda.
+    auto type = expression.expressionType;
+    if (type != ExpressionType::FUNCTION && !ExpressionTypeUtil::isBoolean(type) &&
+        !ExpressionTypeUtil::isComparison(type) && !ExpressionTypeUtil::isNullOperator(type)) {
+        return;
+    }
+    for (auto i = 0u; i < expression.getNumChildren(); ++i) {
+        expression.setChild(i, rewriteExpression(expression.getChild(i), schema));
+    }
+}
+
+std::shared_ptr<Expression> ExpressionRewriteOptimizer::foldExpression(
+    const std::shared_ptr<Expression>& expression) {
+    auto value =
+        evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(expression, context);
+    return createLiteral(std::move(value), *expression);
+}
+
+std::shared_ptr<Expression> ExpressionRewriteOptimizer::simplifyBoolean(
+    const std::shared_ptr<Expression>& expression) {
+    switch (expression->expressionType) {
+    case ExpressionType::AND:
+    case ExpressionType::OR: {
+        KU_ASSERT(expression->getNumChildren() == 2);
+        // x AND false -> false, x AND true -> x, x OR true -> true, x OR false -> x.
+        auto isAnd = expression->expressionType == ExpressionType::AND;
+        auto left = expression->getChild(0);
+        auto right = expression->getChild(1);
+        if (isBoolLiteral(*left, !isAnd) || isBoolLiteral(*right, !isAnd)) {
+            return createLiteral(Value(!isAnd), *expression);
+        }
+        if (isBoolLiteral(*left, isAnd)) {
+            return right;
+        }
+        if (isBoolLiteral(*right, isAnd)) {
+            return left;
+        }
+        return expression;
+    }
+    case ExpressionType::NOT: {
+        auto child = expression->getChild(0);
+        if (child->expressionType == ExpressionType::NOT) {
+            return child->getChild(0);
+        }
+        return expression;
+    }
+    default:
+        return expression;
+    }
+}
+
+static void collectDisjuncts(const std::shared_ptr<Expression>& expression,
+    expression_vector& disjuncts) {
+    if (expression->expressionType != ExpressionType::OR) {
+        disjuncts.push_back(expression);
+        return;
+    }
+    for (auto& child : expression->getChildren()) {
+        collectDisjuncts(child, disjuncts);
+    }
+}
+
+// If the disjunct is x = literal or list_contains(literal list, x), appends the literal values to
+// values and returns x. Otherwise, returns nullptr.
+static std::shared_ptr<Expression> getComparedExpression(const Expression& disjunct,
+    std::vector<std::unique_ptr<Value>>& values) {
+    if (disjunct.expressionType == ExpressionType::EQUALS) {
+        for (auto i = 0u; i < 2; ++i) {
+            auto literal = disjunct.getChild(i);
+            auto compared = disjunct.getChild(1 - i);
+            if (literal->expressionType != ExpressionType::LITERAL ||
+                compared->expressionType == ExpressionType::LITERAL) {
+                continue;
+            }
+            // x = NULL OR x = a is null rather than false if x != a.
+            auto value = literal->constCast<LiteralExpression>().getValue();
+            if (value.isNull()) {
+                return nullptr;
+            }
+            values.push_back(value.copy());
+            return compared;
+        }
+        return nullptr;
+    }
+    if (disjunct.expressionType == ExpressionType::FUNCTION &&
+        disjunct.constCast<ScalarFunctionExpression>().getFunction().name ==
+            function::ListContainsFunction::name &&
+        disjunct.getChild(0)->expressionType == ExpressionType::LITERAL) {
+        auto list = disjunct.getChild(0)->constCast<LiteralExpression>().getValue();
+        if (list.isNull()) {
+            return nullptr;
+        }
+        for (auto i = 0u; i < NestedVal::getChildrenSize(&list); ++i) {
+            auto value = NestedVal::getChildVal(&list, i);
+            if (value->isNull()) {
+                return nullptr;
+            }
+            values.push_back(value->copy());
+        }
+        return disjunct.getChild(1);
+    }
+    return nullptr;
+}
+
+std::shared_ptr<Expression> ExpressionRewriteOptimizer::rewriteDisjunctionToIn(
+    const std::shared_ptr<Expression>& expression) {
+    expression_vector disjuncts;
+    collectDisjuncts(expression, disjuncts);
+    std::vector<std::unique_ptr<Value>> values;
+    std::shared_ptr<Expression> compared;
+    for (auto& disjunct : disjuncts) {
+        auto disjunctCompared = getComparedExpression(*disjunct, values);
+        if (disjunctCompared == nullptr ||
+            (compared != nullptr && *compared != *disjunctCompared)) {
+            return expression;
+        }
+        compared = disjunctCompared;
+    }
+    auto& type = compared->getDataType();
+    if (LogicalTypeUtils::isNested(type)) {
+        return expression;
+    }
+    for (auto& value : values) {
+        if (value->getDataType() != type) {
+            return expression;
+        }
+    }
+    auto list = std::make_shared<LiteralExpression>(
+        Value(LogicalType::LIST(type.copy()), std::move(values)),
+        expression->getUniqueName() + "_list");
+    auto binder = Binder(context);
+    return binder.getExpressionBinder()->bindScalarFunctionExpression(
+        expression_vector{std::move(list), compared}, function::ListContainsFunction::name);
+}
+
+static bool isIntegerType(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns true if every value of the source type can be represented in the target type.
+static bool isLosslessIntegerCast(const LogicalType& source, const LogicalType& target) {
+    return TypeUtils::visit(source, [&]<typename S>(S) {
+        return TypeUtils::visit(target, [&]<typename T>(T) {
+            if constexpr (std::integral<S> && std::integral<T> && !std::is_same_v<S, bool> &&
+                          !std::is_same_v<T, bool>) {
+                return std::in_range<T>(std::numeric_limits<S>::min()) &&
+                       std::in_range<T>(std::numeric_limits<S>::max());
+            } else {
+                return false;
+            }
+        });
+    });
+}
+
+// Returns the value cast to the target integer type, or nullptr if it is out of range.
+static std::unique_ptr<Value> tryCastIntegerValue(const Value& value, const LogicalType& target) {
+    return TypeUtils::visit(value.getDataType(), [&]<typename S>(S) {
+        return TypeUtils::visit(target, [&]<typename T>(T) -> std::unique_ptr<Value> {
+            if constexpr (std::integral<S> && std::integral<T> && !std::is_same_v<S, bool> &&
+                          !std::is_same_v<T, bool>) {
+                auto val = value.getValue<S>();
+                if (!std::in_range<T>(val)) {
+                    return nullptr;
+                }
+                return std::make_unique<Value>((T)val);
+            } else {
+                return nullptr;
+            }
+        });
+    });
+}
+
+std::shared_ptr<Expression> ExpressionRewriteOptimizer::eliminateCastInComparison(
+    const std::shared_ptr<Expression>& expression) {
+    if (expression->getNumChildren() != 2) {
+        return expression;
+    }
+    for (auto i = 0u; i < 2; ++i) {
+        auto cast = expression->getChild(i);
+        auto literal = expression->getChild(1 - i);
+        if (cast->expressionType != ExpressionType::FUNCTION ||
+            cast->constCast<ScalarFunctionExpression>().getFunction().name !=
+                function::CastAnyFunction::name ||
+            literal->expressionType != ExpressionType::LITERAL ||
+            literal->constCast<LiteralExpression>().isNull()) {
+            continue;
+        }
+        auto input = cast->getChild(0);
+        auto& inputType = input->getDataType();
+        auto& castType = cast->getDataType();
+        if (!isIntegerType(inputType) || !isIntegerType(castType) ||
+            literal->getDataType() != castType || !isLosslessIntegerCast(inputType, castType)) {
+            continue;
+        }
+        auto value =
+            tryCastIntegerValue(literal->constCast<LiteralExpression>().getValue(), inputType);
+        if (value == nullptr) {
+            continue;
+        }
+        expression_vector children(2);
+        children[i] = input;
+        children[1 - i] = std::make_shared<LiteralExpression>(std::move(*value),
+            literal->getUniqueName() + "_" + inputType.toString());
+        auto binder = Binder(context);
+        return binder.getExpressionBinder()->bindComparisonExpression(expression->expressionType,
+            children);
+    }
+    return expression;
+}
+
+} // namespace optimizer
+} // namespace kuzu
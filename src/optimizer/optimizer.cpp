@@ -3,7 +3,10 @@
 #include "main/client_context.h"
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
+#include "optimizer/common_subexpression_eliminator.h"
+#include "optimizer/count_rel_table_optimizer.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
+#include "optimizer/expression_rewrite_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
 #include "optimizer/projection_push_down_optimizer.h"
@@ -25,12 +28,20 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
     auto removeUnnecessaryJoinOptimizer = RemoveUnnecessaryJoinOptimizer();
     removeUnnecessaryJoinOptimizer.rewrite(plan);
 
+    // Simplify predicates before they are pushed down so that scans see e.g. folded parameters.
+    auto expressionRewriteOptimizer = ExpressionRewriteOptimizer(context);
+    expressionRewriteOptimizer.rewrite(plan);
+
     auto filterPushDownOptimizer = FilterPushDownOptimizer(context);
     filterPushDownOptimizer.rewrite(plan);
 
     auto projectionPushDownOptimizer = ProjectionPushDownOptimizer();
     projectionPushDownOptimizer.rewrite(plan);
 
+    // Rel counts are rewritten after filter push down, which may add rel predicates to extends.
+    auto countRelTableOptimizer = CountRelTableOptimizer();
+    countRelTableOptimizer.rewrite(plan);
+
     if (context->getClientConfig()->enableSemiMask) {
         // HashJoinSIPOptimizer should be applied after optimizers that manipulate hash join.
         auto hashJoinSIPOptimizer = HashJoinSIPOptimizer();
@@ -40,6 +51,11 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
     auto topKOptimizer = TopKOptimizer();
     topKOptimizer.rewrite(plan);
 
+    // Shared expressions are computed by inserted projections, whose factorization structure is
+    // resolved by FactorizationRewriter.
+    auto commonSubexpressionEliminator = CommonSubexpressionEliminator();
+    commonSubexpressionEliminator.rewrite(plan);
+
     auto factorizationRewriter = FactorizationRewriter();
     factorizationRewriter.rewrite(plan);
 
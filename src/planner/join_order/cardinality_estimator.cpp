@@ -1,6 +1,10 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -8,6 +12,7 @@
 #include "storage/store/table.h"
 
 using namespace kuzu::binder;
+using namespace kuzu::catalog;
 using namespace kuzu::common;
 using namespace kuzu::transaction;
 
@@ -93,17 +98,24 @@ static bool isPrimaryKey(const Expression& expression) {
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalPlan& childPlan,
     const Expression& predicate) {
-    if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            return atLeastOne(
-                childPlan.estCardinality * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
-        }
-    } else {
-        return atLeastOne(
-            childPlan.estCardinality * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
     }
+    return atLeastOne(childPlan.estCardinality * getSelectivity(predicate));
+}
+
+double CardinalityEstimator::estimateSelectivity(const LogicalPlan& childPlan,
+    const expression_vector& predicates) {
+    if (childPlan.estCardinality == 0) {
+        return 1;
+    }
+    auto plan = LogicalPlan();
+    plan.setCardinality(childPlan.estCardinality);
+    for (auto& predicate : predicates) {
+        plan.setCardinality(estimateFilter(plan, *predicate));
+    }
+    return static_cast<double>(plan.estCardinality) / childPlan.estCardinality;
 }
 
 uint64_t CardinalityEstimator::getNumNodes(const std::vector<table_id_t>& tableIDs) {
@@ -122,6 +134,192 @@ uint64_t CardinalityEstimator::getNumRels(const std::vector<table_id_t>& tableID
     return atLeastOne(numRels);
 }
 
+static bool isComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+double CardinalityEstimator::getSelectivity(const Expression& predicate) {
+    auto defaultSelectivity = predicate.expressionType == ExpressionType::EQUALS ?
+                                  PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY :
+                                  PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    auto selectivity = defaultSelectivity;
+    if (isComparison(predicate.expressionType)) {
+        selectivity = getComparisonSelectivity(predicate);
+    } else if (predicate.expressionType == ExpressionType::IS_NULL ||
+               predicate.expressionType == ExpressionType::IS_NOT_NULL) {
+        if (auto statistics = getPropertyStatistics(*predicate.getChild(0))) {
+            selectivity = predicate.expressionType == ExpressionType::IS_NULL ?
+                              statistics->nullFraction :
+                              1 - statistics->nullFraction;
+        }
+    }
+    return std::clamp(selectivity, 0.0, 1.0);
+}
+
+static std::optional<Value> getConstantValue(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+        return expression.constCast<LiteralExpression>().getValue();
+    case ExpressionType::PARAMETER:
+        return expression.constCast<ParameterExpression>().getValue();
+    default:
+        return std::nullopt;
+    }
+}
+
+static std::optional<double> getNumericValue(const Value& value) {
+    if (value.isNull()) {
+        return std::nullopt;
+    }
+    switch (value.getDataType().getLogicalTypeID()) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return value.getValue<int64_t>();
+    case LogicalTypeID::INT32:
+        return value.getValue<int32_t>();
+    case LogicalTypeID::INT16:
+        return value.getValue<int16_t>();
+    case LogicalTypeID::INT8:
+        return value.getValue<int8_t>();
+    case LogicalTypeID::UINT64:
+        return value.getValue<uint64_t>();
+    case LogicalTypeID::UINT32:
+        return value.getValue<uint32_t>();
+    case LogicalTypeID::UINT16:
+        return value.getValue<uint16_t>();
+    case LogicalTypeID::UINT8:
+        return value.getValue<uint8_t>();
+    case LogicalTypeID::DOUBLE:
+        return value.getValue<double>();
+    case LogicalTypeID::FLOAT:
+        return value.getValue<float>();
+    default:
+        return std::nullopt;
+    }
+}
+
+// Rewrite c < x as x > c etc.
+static ExpressionType reverseComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+double CardinalityEstimator::getComparisonSelectivity(const Expression& predicate) {
+    auto type = predicate.expressionType;
+    auto defaultSelectivity = type == ExpressionType::EQUALS ?
+                                  PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY :
+                                  PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    auto leftStatistics = getPropertyStatistics(*predicate.getChild(0));
+    auto rightStatistics = getPropertyStatistics(*predicate.getChild(1));
+    if (leftStatistics && rightStatistics) {
+        // Join predicate between two properties. Assume the values of the property with fewer
+        // distinct values are contained in the other one.
+        if (leftStatistics->numDistinct == 0 || rightStatistics->numDistinct == 0) {
+            return defaultSelectivity;
+        }
+        auto equalitySelectivity = (1 - leftStatistics->nullFraction) *
+                                   (1 - rightStatistics->nullFraction) /
+                                   std::max(leftStatistics->numDistinct,
+                                       rightStatistics->numDistinct);
+        switch (type) {
+        case ExpressionType::EQUALS:
+            return equalitySelectivity;
+        case ExpressionType::NOT_EQUALS:
+            return (1 - leftStatistics->nullFraction) * (1 - rightStatistics->nullFraction) -
+                   equalitySelectivity;
+        default:
+            return defaultSelectivity;
+        }
+    }
+    // Predicate between a property and a constant.
+    std::optional<Value> constant;
+    if (leftStatistics) {
+        constant = getConstantValue(*predicate.getChild(1));
+    } else if (rightStatistics) {
+        constant = getConstantValue(*predicate.getChild(0));
+        leftStatistics = std::move(rightStatistics);
+        type = reverseComparison(type);
+    }
+    if (!constant) {
+        return defaultSelectivity;
+    }
+    auto& statistics = *leftStatistics;
+    if (constant->isNull()) {
+        // Comparisons with null are never true.
+        return 0;
+    }
+    switch (type) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS: {
+        if (statistics.numDistinct == 0) {
+            return defaultSelectivity;
+        }
+        auto equalitySelectivity = statistics.getEqualitySelectivity();
+        return type == ExpressionType::EQUALS ? equalitySelectivity :
+                                                1 - statistics.nullFraction - equalitySelectivity;
+    }
+    default:
+        break;
+    }
+    auto value = getNumericValue(*constant);
+    if (!statistics.hasHistogram() || !value) {
+        return defaultSelectivity;
+    }
+    switch (type) {
+    case ExpressionType::LESS_THAN:
+        return statistics.getLessThanSelectivity(*value, false /* inclusive */);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return statistics.getLessThanSelectivity(*value, true /* inclusive */);
+    case ExpressionType::GREATER_THAN:
+        return 1 - statistics.nullFraction -
+               statistics.getLessThanSelectivity(*value, true /* inclusive */);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return 1 - statistics.nullFraction -
+               statistics.getLessThanSelectivity(*value, false /* inclusive */);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::optional<PropertyStatistics> CardinalityEstimator::getPropertyStatistics(
+    const Expression& expression) {
+    if (expression.expressionType != ExpressionType::PROPERTY) {
+        return std::nullopt;
+    }
+    auto& property = expression.constCast<PropertyExpression>();
+    auto tableIDs = property.getTableIDs();
+    if (tableIDs.size() != 1) {
+        return std::nullopt;
+    }
+    auto transaction = context->getTx();
+    auto catalog = context->getCatalog();
+    auto statistics = catalog->getTableCatalogEntry(transaction, tableIDs[0])->getStatistics();
+    if (statistics == nullptr || !statistics->containsProperty(property.getPropertyName())) {
+        return std::nullopt;
+    }
+    return statistics->getPropertyStatistics(property.getPropertyName());
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     const NodeExpression& boundNode) {
     auto numBoundNodes = (double)getNumNodes(boundNode.getTableIDs());
@@ -0,0 +1,28 @@
+#include "planner/operator/extend/logical_count_rel_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace planner {
+
+void LogicalCountRelTable::computeFactorizedSchema() {
+    copyChildSchema(0);
+    const auto boundGroupPos = schema->getGroupPos(*boundNode->getInternalID());
+    schema->insertToGroupAndScope(countExpr, boundGroupPos);
+}
+
+void LogicalCountRelTable::computeFlatSchema() {
+    copyChildSchema(0);
+    schema->insertToGroupAndScope(countExpr, 0);
+}
+
+std::string LogicalCountRelTable::getExpressionsForPrinting() const {
+    auto result = countExpr->toString() + ": " + boundNode->toString();
+    result += direction == ExtendDirection::FWD ? "-" : "<-";
+    result += rel->toString();
+    result += direction == ExtendDirection::FWD ? "->" : "-";
+    return result;
+}
+
+} // namespace planner
+} // namespace kuzu
@@ -18,10 +18,14 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "ALTER";
     case LogicalOperatorType::ATTACH_DATABASE:
         return "ATTACH_DATABASE";
+    case LogicalOperatorType::BLOOM_FILTER_PROBE:
+        return "BLOOM_FILTER_PROBE";
     case LogicalOperatorType::COPY_FROM:
         return "COPY_FROM";
     case LogicalOperatorType::COPY_TO:
         return "COPY_TO";
+    case LogicalOperatorType::COUNT_REL_TABLE:
+        return "COUNT_REL_TABLE";
     case LogicalOperatorType::CREATE_MACRO:
         return "CREATE_MACRO";
     case LogicalOperatorType::CREATE_SEQUENCE:
@@ -52,6 +56,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "EXPORT_DATABASE";
     case LogicalOperatorType::EXTEND:
         return "EXTEND";
+    case LogicalOperatorType::FETCH_NODE_PROPERTY:
+        return "FETCH_NODE_PROPERTY";
     case LogicalOperatorType::FILTER:
         return "FILTER";
     case LogicalOperatorType::FLATTEN:
@@ -0,0 +1,22 @@
+#include "planner/operator/scan/logical_fetch_node_property.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalFetchNodeProperty::computeFactorizedSchema() {
+    copyChildSchema(0);
+    const auto groupPos = schema->getGroupPos(*nodeID);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, groupPos);
+    }
+}
+
+void LogicalFetchNodeProperty::computeFlatSchema() {
+    copyChildSchema(0);
+    for (auto& property : properties) {
+        schema->insertToGroupAndScope(property, 0);
+    }
+}
+
+} // namespace planner
+} // namespace kuzu
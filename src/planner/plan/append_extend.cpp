@@ -191,6 +191,45 @@ void Planner::appendRecursiveExtendAsGDS(const std::shared_ptr<NodeExpression>&
     appendHashJoin(joinConditions, JoinType::INNER, probePlan, plan, plan);
 }
 
+static ExtendDirection getReverseDirection(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
+// Returns true if a predicate binds the node to a single node through a primary key equality with
+// a literal or a parameter.
+static bool isPointLookup(const NodeExpression& node, const expression_vector& predicates) {
+    if (node.isMultiLabeled()) {
+        return false;
+    }
+    for (auto& predicate : predicates) {
+        if (predicate->expressionType != ExpressionType::EQUALS) {
+            continue;
+        }
+        for (auto i = 0u; i < 2; ++i) {
+            auto& property = *predicate->getChild(i);
+            auto& value = *predicate->getChild(1 - i);
+            if (property.expressionType != ExpressionType::PROPERTY ||
+                (value.expressionType != ExpressionType::LITERAL &&
+                    value.expressionType != ExpressionType::PARAMETER)) {
+                continue;
+            }
+            auto& propertyExpr = property.constCast<PropertyExpression>();
+            if (propertyExpr.getVariableName() == node.getUniqueName() &&
+                propertyExpr.isPrimaryKey()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& boundNode,
     const std::shared_ptr<NodeExpression>& nbrNode, const std::shared_ptr<RelExpression>& rel,
     ExtendDirection direction, LogicalPlan& plan) {
@@ -208,6 +247,17 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
         extendFromSource, RecursiveJoinType::TRACK_PATH, plan.getLastOperator(),
         recursivePlan->getLastOperator());
+    // A shortest path between two point lookups is computed by a BFS from both ends, which needs
+    // a recursive plan extending from the nbr node. Nodes where both ends meet are not checked
+    // against node predicates, so those are always computed from the bound node only.
+    auto whereExpressions = context.getWhereExpressions();
+    if (rel->getRelType() == QueryRelType::SHORTEST && recursiveInfo->nodePredicate == nullptr &&
+        isPointLookup(*boundNode, whereExpressions) && isPointLookup(*nbrNode, whereExpressions)) {
+        auto reverseRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, getReverseDirection(direction), !extendFromSource,
+            *reverseRecursivePlan);
+        extend->setReverseRecursiveChild(reverseRecursivePlan->getLastOperator());
+    }
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
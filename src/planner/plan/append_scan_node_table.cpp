@@ -1,4 +1,5 @@
 #include "binder/expression/property_expression.h"
+#include "planner/operator/scan/logical_fetch_node_property.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -29,5 +30,13 @@ void Planner::appendScanNodeTable(std::shared_ptr<Expression> nodeID,
     plan.setLastOperator(std::move(scan));
 }
 
+void Planner::appendFetchNodeProperty(std::shared_ptr<Expression> nodeID, table_id_t tableID,
+    const expression_vector& properties, LogicalPlan& plan) {
+    auto fetch = std::make_shared<LogicalFetchNodeProperty>(std::move(nodeID), tableID,
+        properties, plan.getLastOperator());
+    fetch->computeFactorizedSchema();
+    plan.setLastOperator(std::move(fetch));
+}
+
 } // namespace planner
 } // namespace kuzu
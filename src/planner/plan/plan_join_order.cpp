@@ -175,8 +175,17 @@ void Planner::planLevelExactly(uint32_t level) {
     }
 }
 
+// Joining all neighbour subgraphs of a given size is exponential in the size. For large query
+// graphs, we only join subgraphs that have been kept in the subplans table, which keeps the
+// cheapest subgraphs of each level. This still allows bushy hash joins and WCOJs.
 void Planner::planLevelApproximately(uint32_t level) {
     planInnerJoin(1, level - 1);
+    auto maxLeftLevel = floor(level / 2.0);
+    for (auto leftLevel = 2u; leftLevel <= maxLeftLevel; ++leftLevel) {
+        auto rightLevel = level - leftLevel;
+        planWCOJoin(leftLevel, rightLevel);
+        planInnerJoinOfPlannedSubgraphs(leftLevel, rightLevel);
+    }
 }
 
 void Planner::planBaseTableScans(const QueryGraphPlanningInfo& info) {
@@ -242,6 +251,35 @@ void Planner::planCorrelatedExpressionsScan(const QueryGraphPlanningInfo& info)
     context.addPlan(newSubgraph, std::move(plan));
 }
 
+// Split properties into the ones used by predicates and the others. Predicates with subqueries
+// are planned as joins, so all properties are considered used.
+static std::pair<expression_vector, expression_vector> splitPropertiesByPredicates(
+    const expression_vector& properties, const expression_vector& predicates) {
+    std::unordered_set<std::string> propertyNamesInPredicates;
+    for (auto& predicate : predicates) {
+        auto subqueryCollector = SubqueryExprCollector();
+        subqueryCollector.visit(predicate);
+        if (subqueryCollector.hasSubquery()) {
+            return {properties, expression_vector{}};
+        }
+        auto propertyCollector = PropertyExprCollector();
+        propertyCollector.visit(predicate);
+        for (auto& property : propertyCollector.getPropertyExprs()) {
+            propertyNamesInPredicates.insert(property->getUniqueName());
+        }
+    }
+    expression_vector propertiesInPredicates;
+    expression_vector otherProperties;
+    for (auto& property : properties) {
+        if (propertyNamesInPredicates.contains(property->getUniqueName())) {
+            propertiesInPredicates.push_back(property);
+        } else {
+            otherProperties.push_back(property);
+        }
+    }
+    return {propertiesInPredicates, otherProperties};
+}
+
 void Planner::planNodeScan(uint32_t nodePos) {
     auto node = context.queryGraph->getQueryNode(nodePos);
     auto newSubgraph = context.getEmptySubqueryGraph();
@@ -251,7 +289,26 @@ void Planner::planNodeScan(uint32_t nodePos) {
     appendScanNodeTable(node->getInternalID(), node->getTableIDs(), properties, *plan);
     auto predicates = getNewlyMatchedExprs(context.getEmptySubqueryGraph(), newSubgraph,
         context.getWhereExpressions());
+    // Late materialization. If few nodes pass the predicates, the scan only reads the properties
+    // used by the predicates, and the other properties are fetched for the remaining nodes.
+    expression_vector propertiesToFetch;
+    if (node->getTableIDs().size() == 1 && !predicates.empty() &&
+        cardinalityEstimator.estimateSelectivity(*plan, predicates) <=
+            PlannerKnobs::LATE_MATERIALIZATION_SELECTIVITY) {
+        auto& scan = plan->getLastOperator()->cast<LogicalScanNodeTable>();
+        auto [propertiesToScan, otherProperties] =
+            splitPropertiesByPredicates(scan.getProperties(), predicates);
+        if (!otherProperties.empty()) {
+            scan.setProperties(std::move(propertiesToScan));
+            scan.computeFactorizedSchema();
+            propertiesToFetch = std::move(otherProperties);
+        }
+    }
     appendFilters(predicates, *plan);
+    if (!propertiesToFetch.empty()) {
+        appendFetchNodeProperty(node->getInternalID(), node->getTableIDs()[0], propertiesToFetch,
+            *plan);
+    }
     context.addPlan(newSubgraph, std::move(plan));
 }
 
@@ -371,6 +428,7 @@ void Planner::planWCOJoin(uint32_t leftLevel, uint32_t rightLevel) {
 
 static LogicalOperator* getSequentialScan(LogicalOperator* op) {
     switch (op->getOperatorType()) {
+    case LogicalOperatorType::FETCH_NODE_PROPERTY:
     case LogicalOperatorType::FLATTEN:
     case LogicalOperatorType::FILTER:
     case LogicalOperatorType::EXTEND:
@@ -496,20 +554,40 @@ void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
             if (!context.containPlans(nbrSubgraph)) {
                 continue;
             }
-            auto joinNodePositions = rightSubgraph.getConnectedNodePos(nbrSubgraph);
-            auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
-            if (needPruneImplicitJoins(nbrSubgraph, rightSubgraph, joinNodes.size())) {
-                continue;
-            }
-            // If index nested loop (INL) join is possible, we prune hash join plans
-            if (tryPlanINLJoin(rightSubgraph, nbrSubgraph, joinNodes)) {
+            planInnerJoin(rightSubgraph, nbrSubgraph, leftLevel != rightLevel);
+        }
+    }
+}
+
+void Planner::planInnerJoinOfPlannedSubgraphs(uint32_t leftLevel, uint32_t rightLevel) {
+    KU_ASSERT(leftLevel <= rightLevel);
+    auto leftSubgraphs = context.subPlansTable->getSubqueryGraphs(leftLevel);
+    for (auto& rightSubgraph : context.subPlansTable->getSubqueryGraphs(rightLevel)) {
+        for (auto& leftSubgraph : leftSubgraphs) {
+            if (!rightSubgraph.isDisjoint(leftSubgraph) ||
+                rightSubgraph.getConnectedNodePos(leftSubgraph).empty()) {
                 continue;
             }
-            planInnerHashJoin(rightSubgraph, nbrSubgraph, joinNodes, leftLevel != rightLevel);
+            // If both subgraphs are on the same level, each of them is visited on both sides.
+            planInnerJoin(rightSubgraph, leftSubgraph, leftLevel != rightLevel);
         }
     }
 }
 
+void Planner::planInnerJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
+    bool flipPlan) {
+    auto joinNodePositions = subgraph.getConnectedNodePos(otherSubgraph);
+    auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
+    if (needPruneImplicitJoins(otherSubgraph, subgraph, joinNodes.size())) {
+        return;
+    }
+    // If index nested loop (INL) join is possible, we prune hash join plans
+    if (tryPlanINLJoin(subgraph, otherSubgraph, joinNodes)) {
+        return;
+    }
+    planInnerHashJoin(subgraph, otherSubgraph, joinNodes, flipPlan);
+}
+
 bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
     if (joinNodes.size() > 1) {
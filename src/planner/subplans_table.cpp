@@ -41,6 +41,14 @@ void SubgraphPlans::addPlan(std::unique_ptr<LogicalPlan> plan) {
     }
 }
 
+uint64_t SubgraphPlans::getMinCost() const {
+    auto minCost = UINT64_MAX;
+    for (auto& plan : plans) {
+        minCost = std::min(minCost, plan->getCost());
+    }
+    return minCost;
+}
+
 std::bitset<MAX_NUM_QUERY_VARIABLES> SubgraphPlans::encodePlan(const LogicalPlan& plan) {
     auto schema = plan.getSchema();
     std::bitset<MAX_NUM_QUERY_VARIABLES> result;
@@ -61,8 +69,21 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
 
 void DPLevel::addPlan(const kuzu::binder::SubqueryGraph& subqueryGraph,
     std::unique_ptr<LogicalPlan> plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
-        return;
+    if (!contains(subqueryGraph) && subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
+        // Replace the subgraph whose cheapest plan is the most expensive one.
+        auto subgraphToRemove = subgraph2Plans.begin();
+        auto maxMinCost = subgraphToRemove->second->getMinCost();
+        for (auto it = subgraph2Plans.begin(); it != subgraph2Plans.end(); ++it) {
+            auto minCost = it->second->getMinCost();
+            if (minCost > maxMinCost) {
+                maxMinCost = minCost;
+                subgraphToRemove = it;
+            }
+        }
+        if (plan->getCost() >= maxMinCost) {
+            return;
+        }
+        subgraph2Plans.erase(subgraphToRemove);
     }
     if (!contains(subqueryGraph)) {
         subgraph2Plans.insert({subqueryGraph, std::make_unique<SubgraphPlans>(subqueryGraph)});
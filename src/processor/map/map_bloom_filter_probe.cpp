@@ -0,0 +1,34 @@
+#include "planner/operator/sip/logical_bloom_filter_probe.h"
+#include "processor/operator/bloom_filter_probe.h"
+#include "processor/operator/hash_join/hash_join_build.h"
+#include "processor/plan_mapper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapBloomFilterProbe(
+    LogicalOperator* logicalOperator) {
+    auto& probe = logicalOperator->constCast<LogicalBloomFilterProbe>();
+    auto inSchema = probe.getChild(0)->getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto keyPos = getDataPos(*probe.getKey(), *inSchema);
+    auto printInfo = std::make_unique<OPPrintInfo>(probe.getExpressionsForPrinting());
+    return std::make_unique<BloomFilterProbe>(keyPos, std::make_shared<BloomFilter>(),
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+void PlanMapper::mapBloomFilterProbes(const std::vector<LogicalOperator*>& probes,
+    const std::vector<std::shared_ptr<HashJoinSharedState>>& sharedStates) {
+    for (auto& probe : probes) {
+        KU_ASSERT(logicalOpToPhysicalOpMap.contains(probe));
+        auto buildIdx = probe->constCast<LogicalBloomFilterProbe>().getBuildIdx();
+        auto& physicalProbe = logicalOpToPhysicalOpMap.at(probe)->constCast<BloomFilterProbe>();
+        sharedStates[buildIdx]->setBloomFilter(physicalProbe.getBloomFilter());
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,29 @@
+#include "planner/operator/extend/logical_count_rel_table.h"
+#include "processor/operator/scan/count_rel_table.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapCountRelTable(LogicalOperator* logicalOperator) {
+    auto& countRelTable = logicalOperator->constCast<LogicalCountRelTable>();
+    auto inSchema = countRelTable.getChild(0)->getSchema();
+    auto outSchema = countRelTable.getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto nodeIDPos = getDataPos(*countRelTable.getBoundNode()->getInternalID(), *inSchema);
+    auto countPos = getDataPos(*countRelTable.getCountExpr(), *outSchema);
+    auto relTableID = countRelTable.getRel()->getSingleEntry()->getTableID();
+    auto relTable = clientContext->getStorageManager()->getTable(relTableID)->ptrCast<RelTable>();
+    auto direction = ExtendDirectionUtil::getRelDataDirection(countRelTable.getDirection());
+    auto printInfo = std::make_unique<OPPrintInfo>(countRelTable.getExpressionsForPrinting());
+    return std::make_unique<CountRelTable>(relTable, direction, nodeIDPos, countPos,
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,43 @@
+#include "binder/expression/property_expression.h"
+#include "planner/operator/scan/logical_fetch_node_property.h"
+#include "processor/operator/scan/fetch_node_property.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapFetchNodeProperty(
+    LogicalOperator* logicalOperator) {
+    auto& fetch = logicalOperator->constCast<LogicalFetchNodeProperty>();
+    auto outSchema = fetch.getSchema();
+    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto nodeIDPos = getDataPos(*fetch.getNodeID(), *outSchema);
+    std::vector<DataPos> outVectorsPos;
+    for (auto& expression : fetch.getProperties()) {
+        outVectorsPos.emplace_back(getDataPos(*expression, *outSchema));
+    }
+    auto tableID = fetch.getTableID();
+    auto tableEntry =
+        clientContext->getCatalog()->getTableCatalogEntry(clientContext->getTx(), tableID);
+    std::vector<column_id_t> columnIDs;
+    for (auto& expression : fetch.getProperties()) {
+        auto& property = expression->constCast<PropertyExpression>();
+        KU_ASSERT(property.hasProperty(tableID));
+        columnIDs.push_back(tableEntry->getColumnID(property.getPropertyName()));
+    }
+    auto storageManager = clientContext->getStorageManager();
+    auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
+    auto nodeInfo = ScanNodeTableInfo(table, std::move(columnIDs), {});
+    auto printInfo = std::make_unique<ScanNodeTablePrintInfo>(
+        std::vector<std::string>{table->getTableName()}, fetch.getProperties());
+    return std::make_unique<FetchNodeProperty>(ScanTableInfo(nodeIDPos, std::move(outVectorsPos)),
+        std::move(nodeInfo), std::move(prevOperator), getOperatorID(), std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
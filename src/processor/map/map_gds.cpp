@@ -28,7 +28,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapGDSCall(LogicalOperator* logica
     auto table =
         std::make_shared<FactorizedTable>(clientContext->getMemoryManager(), tableSchema->copy());
     auto graph = std::make_unique<OnDiskGraph>(clientContext, call.getInfo().graphEntry);
-    common::table_id_map_t<std::unique_ptr<NodeOffsetLevelSemiMask>> masks;
+    common::table_id_map_t<std::unique_ptr<NodeSemiMask>> masks;
     if (call.getInfo().getBindData()->hasNodeInput()) {
         // Generate an empty semi mask which later on picked by SemiMaker.
         auto& node =
@@ -38,7 +38,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapGDSCall(LogicalOperator* logica
             auto nodeTable =
                 clientContext->getStorageManager()->getTable(tableID)->ptrCast<NodeTable>();
             masks.insert({tableID,
-                std::make_unique<NodeOffsetLevelSemiMask>(tableID, nodeTable->getNumRows())});
+                std::make_unique<NodeSemiMask>(tableID, nodeTable->getNumRows())});
         }
     }
     auto sharedState =
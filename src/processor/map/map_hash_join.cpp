@@ -86,6 +86,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    mapBloomFilterProbes(hashJoin->getSIPInfo().bloomFilterProbes, {sharedState});
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema),
@@ -48,6 +48,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapIntersect(LogicalOperator* logi
     }
     // Map probe side child.
     children[0] = mapOperator(logicalIntersect->getChild(0).get());
+    mapBloomFilterProbes(logicalIntersect->getSIPInfo().bloomFilterProbes, sharedStates);
     // Map intersect.
     auto outputDataPos =
         DataPos(outSchema->getExpressionPos(*logicalIntersect->getIntersectNodeID()));
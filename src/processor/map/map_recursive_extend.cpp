@@ -12,12 +12,12 @@ namespace processor {
 
 static std::shared_ptr<RecursiveJoinSharedState> createSharedState(const NodeExpression& nbrNode,
     const main::ClientContext& context) {
-    std::vector<std::unique_ptr<common::NodeOffsetLevelSemiMask>> semiMasks;
+    std::vector<std::unique_ptr<common::NodeSemiMask>> semiMasks;
     for (auto entry : nbrNode.getEntries()) {
         auto tableID = entry->getTableID();
         auto table = context.getStorageManager()->getTable(tableID)->ptrCast<storage::NodeTable>();
         semiMasks.push_back(
-            std::make_unique<common::NodeOffsetLevelSemiMask>(tableID, table->getNumRows()));
+            std::make_unique<common::NodeSemiMask>(tableID, table->getNumRows()));
     }
     return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks));
 }
@@ -32,6 +32,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     auto logicalRecursiveRoot = extend->getRecursiveChild();
     auto recursiveRoot = mapOperator(logicalRecursiveRoot.get());
     auto recursivePlanSchema = logicalRecursiveRoot->getSchema();
+    std::unique_ptr<PhysicalOperator> reverseRecursiveRoot;
+    if (auto logicalReverseRecursiveRoot = extend->getReverseRecursiveChild()) {
+        // Both recursive plans run over result sets of the forward plan's schema.
+        KU_ASSERT(getDataPos(*recursiveInfo->nodeCopy->getInternalID(),
+                      *logicalReverseRecursiveRoot->getSchema()) ==
+                  getDataPos(*recursiveInfo->nodeCopy->getInternalID(), *recursivePlanSchema));
+        KU_ASSERT(getDataPos(*recursiveInfo->rel->getInternalIDProperty(),
+                      *logicalReverseRecursiveRoot->getSchema()) ==
+                  getDataPos(*recursiveInfo->rel->getInternalIDProperty(), *recursivePlanSchema));
+        reverseRecursiveRoot = mapOperator(logicalReverseRecursiveRoot.get());
+    }
     // Generate RecursiveJoin
     auto outSchema = extend->getSchema();
     auto inSchema = extend->getChild(0)->getSchema();
@@ -76,7 +87,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto printInfo = std::make_unique<OPPrintInfo>();
     return std::make_unique<RecursiveJoin>(std::move(info), sharedState, std::move(prevOperator),
-        getOperatorID(), std::move(recursiveRoot), std::move(printInfo));
+        getOperatorID(), std::move(recursiveRoot), std::move(reverseRecursiveRoot),
+        std::move(printInfo));
 }
 
 } // namespace processor
@@ -40,12 +40,18 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::ATTACH_DATABASE: {
         physicalOperator = mapAttachDatabase(logicalOperator);
     } break;
+    case LogicalOperatorType::BLOOM_FILTER_PROBE: {
+        physicalOperator = mapBloomFilterProbe(logicalOperator);
+    } break;
     case LogicalOperatorType::COPY_FROM: {
         physicalOperator = mapCopyFrom(logicalOperator);
     } break;
     case LogicalOperatorType::COPY_TO: {
         physicalOperator = mapCopyTo(logicalOperator);
     } break;
+    case LogicalOperatorType::COUNT_REL_TABLE: {
+        physicalOperator = mapCountRelTable(logicalOperator);
+    } break;
     case LogicalOperatorType::CREATE_MACRO: {
         physicalOperator = mapCreateMacro(logicalOperator);
     } break;
@@ -97,6 +103,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::FLATTEN: {
         physicalOperator = mapFlatten(logicalOperator);
     } break;
+    case LogicalOperatorType::FETCH_NODE_PROPERTY: {
+        physicalOperator = mapFetchNodeProperty(logicalOperator);
+    } break;
     case LogicalOperatorType::FILTER: {
         physicalOperator = mapFilter(logicalOperator);
     } break;
@@ -1,5 +1,7 @@
 #include "processor/operator/aggregate/aggregate_hash_table.h"
 
+#include <memory>
+
 #include "common/utils.h"
 
 using namespace kuzu::common;
@@ -31,6 +33,24 @@ AggregateHashTable::AggregateHashTable(MemoryManager& memoryManager,
     initializeTmpVectors();
 }
 
+AggregateHashTable::~AggregateHashTable() {
+    // Aggregate states are copied into factorized table entries, so their destructors are not run
+    // when the table is destroyed. States that own memory release it when their result is moved
+    // out or when they are combined into another state. States that are never scanned, e.g. after
+    // a LIMIT or an interrupted query, are destroyed here.
+    if (aggregateFunctions.empty()) {
+        return;
+    }
+    for (auto i = 0u; i < getNumEntries(); ++i) {
+        auto entry = getEntry(i);
+        auto aggregateStateOffset = aggStateColOffsetInFT;
+        for (auto& aggregateFunction : aggregateFunctions) {
+            std::destroy_at(reinterpret_cast<AggregateState*>(entry + aggregateStateOffset));
+            aggregateStateOffset += aggregateFunction.getAggregateStateSize();
+        }
+    }
+}
+
 uint64_t AggregateHashTable::append(const std::vector<ValueVector*>& flatKeyVectors,
     const std::vector<ValueVector*>& unFlatKeyVectors,
     const std::vector<ValueVector*>& dependentKeyVectors, DataChunkState* leadingState,
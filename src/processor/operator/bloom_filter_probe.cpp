@@ -0,0 +1,44 @@
+#include "processor/operator/bloom_filter_probe.h"
+
+#include "function/hash/vector_hash_functions.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace processor {
+
+void BloomFilterProbe::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* /*context*/) {
+    keyVector = resultSet->getValueVector(keyPos).get();
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH());
+}
+
+bool BloomFilterProbe::getNextTuplesInternal(ExecutionContext* context) {
+    sel_t numSelectedValues = 0;
+    do {
+        restoreSelVector(*keyVector->state);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(*keyVector->state);
+        auto& selVector = keyVector->state->getSelVectorUnsafe();
+        VectorHashFunction::computeHash(*keyVector, selVector, *hashVector, selVector);
+        numSelectedValues = 0;
+        auto buffer = selVector.getMutableBuffer();
+        for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+            auto pos = selVector[i];
+            buffer[numSelectedValues] = pos;
+            // Null keys never join.
+            numSelectedValues += !keyVector->isNull(pos) &&
+                                 bloomFilter->mayContain(hashVector->getValue<hash_t>(pos));
+        }
+        selVector.setToFiltered();
+    } while (numSelectedValues == 0);
+    keyVector->state->getSelVectorUnsafe().setSelSize(numSelectedValues);
+    metrics->numOutputTuple.increase(numSelectedValues);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -55,6 +55,9 @@ void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    if (sharedState->getBloomFilter() != nullptr) {
+        sharedState->getHashTable()->buildBloomFilter(*sharedState->getBloomFilter());
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -63,6 +63,15 @@ static void sortSelectedPos(ValueVector* nodeIDVector) {
     auto& selVector = nodeIDVector->state->getSelVectorUnsafe();
     auto size = selVector.getSelSize();
     auto buffer = selVector.getMutableBuffer();
+    // Adjacency lists are often scanned in sorted order already.
+    auto isSorted = true;
+    for (auto i = 1u; i < size && isSorted; i++) {
+        isSorted = !(nodeIDVector->getValue<nodeID_t>(selVector[i]) <
+                     nodeIDVector->getValue<nodeID_t>(selVector[i - 1]));
+    }
+    if (isSorted) {
+        return;
+    }
     if (selVector.isUnfiltered()) {
         std::memcpy(buffer.data(), &SelectionVector::INCREMENTAL_SELECTED_POS,
             size * sizeof(sel_t));
@@ -127,6 +136,18 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::buildBloomFilter(BloomFilter& bloomFilter) const {
+    bloomFilter.reset(memoryManager, factorizedTable->getNumTuples());
+    const auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        const uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            bloomFilter.insert(*(hash_t*)(tuple + hashColOffset));
+            tuple += tableSchema->getNumBytesPerTuple();
+        }
+    }
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
     SelectionVector& hashSelVec, ValueVector& tmpHashResultVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
@@ -89,7 +89,19 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                 lookupPos[i] = (keyVector->state->getSelVector()[i]);
             }
 
+            // Look up all non-null keys in one batch, then report errors in the original key order
+            std::vector<sel_t> nonNullPos;
+            nonNullPos.reserve(numKeys);
+            for (auto pos : lookupPos) {
+                if (hasNoNullsGuarantee || !keyVector->isNull(pos)) {
+                    nonNullPos.push_back(pos);
+                }
+            }
+            std::vector<offset_t> lookupOffsets(nonNullPos.size());
+            info.nodeTable->lookupPKs(transaction, keyVector, nonNullPos, lookupOffsets);
+
             OffsetVectorManager resultManager{resultVector, errorHandler};
+            idx_t lookupIdx = 0;
             for (auto i = 0u; i < numKeys; i++) {
                 auto pos = lookupPos[i];
                 if constexpr (!hasNoNullsGuarantee) {
@@ -97,8 +109,8 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                         continue;
                     }
                 }
-                offset_t lookupOffset = 0;
-                if (!info.nodeTable->lookupPK(transaction, keyVector, pos, lookupOffset)) {
+                const auto lookupOffset = lookupOffsets[lookupIdx++];
+                if (lookupOffset == INVALID_OFFSET) {
                     auto key = keyVector->getValue<T>(pos);
                     errorHandler->handleError(
                         ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)),
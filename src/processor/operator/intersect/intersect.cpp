@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "function/hash/hash_functions.h"
+#include "processor/operator/intersect/intersect_kernels.h"
 
 using namespace kuzu::common;
 
@@ -65,27 +66,15 @@ void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVect
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
     auto leftPositionBuffer = lSelVector.getMutableBuffer();
-    auto rightPositionBuffer = rSelVector.getMutableBuffer();
-    sel_t leftPosition = 0, rightPosition = 0;
-    uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID.offset < rightNodeID.offset) {
-            leftPosition++;
-        } else if (leftNodeID.offset > rightNodeID.offset) {
-            rightPosition++;
-        } else {
-            leftPositionBuffer[outputValuePosition] = leftPosition;
-            rightPositionBuffer[outputValuePosition] = rightPosition;
-            leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
-        }
+    auto numMatches = IntersectKernels::intersect(leftNodeIDs, lSelVector.getSelSize(),
+        rightNodeIDs, rSelVector.getSelSize(), leftPositionBuffer.data(),
+        rSelVector.getMutableBuffer().data());
+    // Matched positions are increasing, so the left list can be compacted in place.
+    for (auto i = 0u; i < numMatches; i++) {
+        leftNodeIDs[i] = leftNodeIDs[leftPositionBuffer[i]];
     }
-    lSelVector.setToFiltered(outputValuePosition);
-    rSelVector.setToFiltered(outputValuePosition);
+    lSelVector.setToFiltered(numMatches);
+    rSelVector.setToFiltered(numMatches);
 }
 
 static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
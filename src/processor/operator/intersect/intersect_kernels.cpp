@@ -0,0 +1,134 @@
+#include "processor/operator/intersect/intersect_kernels.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+IntersectKernelType IntersectKernels::chooseKernel(const nodeID_t* /*left*/, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize) {
+    if (leftSize == 0 || rightSize == 0) {
+        return IntersectKernelType::MERGE;
+    }
+    if (rightSize >= GALLOPING_SIZE_RATIO * leftSize) {
+        return IntersectKernelType::GALLOPING;
+    }
+    const auto range = right[rightSize - 1].offset - right[0].offset + 1;
+    if (range <= MAX_DENSE_RANGE && range <= DENSE_RANGE_FACTOR * (leftSize + rightSize) &&
+        rightSize < UINT16_MAX) {
+        return IntersectKernelType::DENSE;
+    }
+    return IntersectKernelType::MERGE;
+}
+
+uint64_t IntersectKernels::intersect(const nodeID_t* left, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    return intersect(chooseKernel(left, leftSize, right, rightSize), left, leftSize, right,
+        rightSize, leftPositions, rightPositions);
+}
+
+uint64_t IntersectKernels::intersect(IntersectKernelType kernelType, const nodeID_t* left,
+    uint64_t leftSize, const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions,
+    sel_t* rightPositions) {
+    switch (kernelType) {
+    case IntersectKernelType::MERGE:
+        return merge(left, leftSize, right, rightSize, leftPositions, rightPositions);
+    case IntersectKernelType::GALLOPING:
+        return gallop(left, leftSize, right, rightSize, leftPositions, rightPositions);
+    case IntersectKernelType::DENSE:
+        return denseLookup(left, leftSize, right, rightSize, leftPositions, rightPositions);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+uint64_t IntersectKernels::merge(const nodeID_t* left, uint64_t leftSize, const nodeID_t* right,
+    uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    uint64_t leftPos = 0, rightPos = 0, numMatches = 0;
+    while (leftPos < leftSize && rightPos < rightSize) {
+        const auto leftOffset = left[leftPos].offset;
+        const auto rightOffset = right[rightPos].offset;
+        if (leftOffset < rightOffset) {
+            leftPos++;
+        } else if (leftOffset > rightOffset) {
+            rightPos++;
+        } else {
+            leftPositions[numMatches] = leftPos++;
+            rightPositions[numMatches] = rightPos++;
+            numMatches++;
+        }
+    }
+    return numMatches;
+}
+
+uint64_t IntersectKernels::gallop(const nodeID_t* left, uint64_t leftSize, const nodeID_t* right,
+    uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    uint64_t rightPos = 0, numMatches = 0;
+    for (auto leftPos = 0u; leftPos < leftSize && rightPos < rightSize; leftPos++) {
+        const auto target = left[leftPos].offset;
+        // Exponential search for a range [low, high] of the right list that contains the first
+        // offset >= target. All offsets before low are smaller than the target.
+        auto low = rightPos, high = rightPos;
+        uint64_t step = 1;
+        while (high < rightSize && right[high].offset < target) {
+            low = high + 1;
+            high += step;
+            step <<= 1;
+        }
+        const auto end = std::min(high + 1, rightSize);
+        rightPos = std::lower_bound(right + low, right + end, target,
+                       [](const nodeID_t& nodeID, offset_t offset) {
+                           return nodeID.offset < offset;
+                       }) -
+                   right;
+        if (rightPos < rightSize && right[rightPos].offset == target) {
+            leftPositions[numMatches] = leftPos;
+            rightPositions[numMatches] = rightPos;
+            numMatches++;
+            rightPos++;
+        }
+    }
+    return numMatches;
+}
+
+uint64_t IntersectKernels::denseLookup(const nodeID_t* left, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    static constexpr uint16_t INVALID_POSITION = UINT16_MAX;
+    if (leftSize == 0 || rightSize == 0) {
+        return 0;
+    }
+    const auto base = right[0].offset;
+    const auto range = right[rightSize - 1].offset - base + 1;
+    KU_ASSERT(range <= MAX_DENSE_RANGE && rightSize < INVALID_POSITION);
+    // The table maps each offset of the right list to the position of its next unmatched
+    // occurrence.
+    uint16_t nextPositions[MAX_DENSE_RANGE];
+    std::fill(nextPositions, nextPositions + range, INVALID_POSITION);
+    for (auto rightPos = rightSize; rightPos-- > 0;) {
+        nextPositions[right[rightPos].offset - base] = rightPos;
+    }
+    uint64_t numMatches = 0;
+    for (auto leftPos = 0u; leftPos < leftSize; leftPos++) {
+        const auto offset = left[leftPos].offset;
+        if (offset < base || offset - base >= range) {
+            continue;
+        }
+        const auto rightPos = nextPositions[offset - base];
+        if (rightPos == INVALID_POSITION) {
+            continue;
+        }
+        leftPositions[numMatches] = leftPos;
+        rightPositions[numMatches] = rightPos;
+        numMatches++;
+        const bool hasDuplicate = rightPos + 1u < rightSize && right[rightPos + 1].offset == offset;
+        nextPositions[offset - base] = hasDuplicate ? rightPos + 1 : INVALID_POSITION;
+    }
+    return numMatches;
+}
+
+} // namespace processor
+} // namespace kuzu
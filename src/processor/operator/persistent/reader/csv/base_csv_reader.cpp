@@ -201,15 +201,16 @@ std::string BaseCSVReader::reconstructLine(uint64_t startPosition, uint64_t endP
     return StringUtils::ltrimNewlines(StringUtils::rtrimNewlines(res));
 }
 
-void BaseCSVReader::skipCurrentLine() {
+void BaseCSVReader::skipCurrentLine(CSVRowBoundaryScanner::State state) {
     do {
         for (; position < bufferSize; ++position) {
-            if (isNewLine(buffer[position])) {
+            if (CSVRowBoundaryScanner::isRowEnd(option, state, buffer[position])) {
                 while (position < bufferSize && isNewLine(buffer[position])) {
                     ++position;
                 }
                 return;
             }
+            state = CSVRowBoundaryScanner::step(option, state, buffer[position]);
         }
     } while (maybeReadBuffer(nullptr));
 }
@@ -261,6 +262,9 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
     // used for parsing algorithm
     curRowIdx = 0;
     numErrors = 0;
+    // characters ending unquoted and quoted values
+    const CharSetFinder valueEndFinder{option.delimiter, '\n', '\r'};
+    const CharSetFinder quotedValueEndFinder{option.quoteChar, option.escapeChar};
 
     while (true) {
         column_id_t column = 0;
@@ -297,14 +301,14 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
         // this state parses the remainder of a non-quoted value until we reach a delimiter or
         // newline
         do {
-            for (; position < bufferSize; position++) {
+            position += valueEndFinder.find(buffer.get() + position, bufferSize - position);
+            if (position < bufferSize) {
                 if (buffer[position] == option.delimiter) {
                     // delimiter: end the value and add it to the chunk
                     goto add_value;
-                } else if (isNewLine(buffer[position])) {
-                    // newline: add row
-                    goto add_row;
                 }
+                // newline: add row
+                goto add_row;
             }
         } while (readBuffer(&start));
 
@@ -319,7 +323,7 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
         if (!addValue(driver, curRowIdx, column,
                 std::string_view(buffer.get() + start, position - start - hasQuotes),
                 escapePositions)) {
-            goto ignore_error;
+            goto ignore_value_error;
         }
         column++;
 
@@ -368,10 +372,11 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
         }
     }
     in_quotes:
-        // this state parses the remainder of a quoted value.
+        // this state parses the remainder of a quoted value, which may contain newlines.
         position++;
         do {
-            for (; position < bufferSize; position++) {
+            position += quotedValueEndFinder.find(buffer.get() + position, bufferSize - position);
+            if (position < bufferSize) {
                 if (driver.driverType == DriverType::SNIFF_CSV_DIALECT) {
                     auto& sniffDriver = reinterpret_cast<SniffCSVDialectDriver&>(driver);
                     sniffDriver.setEverQuoted();
@@ -379,13 +384,10 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
                 if (buffer[position] == option.quoteChar) {
                     // quote: move to unquoted state
                     goto unquote;
-                } else if (buffer[position] == option.escapeChar) {
-                    // escape: store the escaped position and move to handle_escape state
-                    escapePositions.push_back(position - start);
-                    goto handle_escape;
-                } else if (isNewLine(buffer[position])) {
-                    [[unlikely]] if (!handleQuotedNewline()) { goto ignore_error; }
                 }
+                // escape: store the escaped position and move to handle_escape state
+                escapePositions.push_back(position - start);
+                goto handle_escape;
             }
         } while (readBuffer(&start));
         [[unlikely]]
@@ -506,9 +508,20 @@ uint64_t BaseCSVReader::parseCSV(Driver& driver) {
                 getOptionalWarningData<Driver>(columnInfo, option, getWarningSourceData()));
         }
         return curRowIdx;
+    ignore_value_error:
+        // the rest of the row may contain quoted newlines, so the row is skipped the way it would
+        // have been parsed.
+        skipCurrentLine(CSVRowBoundaryScanner::State::NORMAL);
+        if (driver.done(curRowIdx)) {
+            return curRowIdx;
+        }
+        continue;
     ignore_error:
         // we skip the current row then restart the state machine to continue parsing
         skipCurrentLine();
+        if (driver.done(curRowIdx)) {
+            return curRowIdx;
+        }
         continue;
     }
     KU_UNREACHABLE;
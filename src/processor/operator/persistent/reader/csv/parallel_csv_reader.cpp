@@ -19,11 +19,46 @@ using namespace kuzu::function;
 namespace kuzu {
 namespace processor {
 
+bool CSVBlockStartStates::hasTransition(block_idx_t blockIdx) {
+    std::lock_guard<std::mutex> guard{mtx};
+    return blockIdx < nextBlockIdx || transitions.contains(blockIdx);
+}
+
+void CSVBlockStartStates::setTransition(block_idx_t blockIdx,
+    const CSVRowBoundaryScanner::state_transition_t& transition) {
+    std::lock_guard<std::mutex> guard{mtx};
+    if (blockIdx >= nextBlockIdx) {
+        transitions.emplace(blockIdx, transition);
+    }
+}
+
+std::optional<CSVRowBoundaryScanner::State> CSVBlockStartStates::takeStartState(
+    block_idx_t blockIdx, block_idx_t& missingBlockIdx) {
+    std::lock_guard<std::mutex> guard{mtx};
+    while (nextBlockIdx < blockIdx) {
+        auto transition = transitions.find(nextBlockIdx);
+        if (transition == transitions.end()) {
+            missingBlockIdx = nextBlockIdx;
+            return std::nullopt;
+        }
+        nextStartState = CSVRowBoundaryScanner::apply(transition->second, nextStartState);
+        transitions.erase(transition);
+        nextBlockIdx++;
+        startStates.emplace(nextBlockIdx, nextStartState);
+    }
+    auto startState = startStates.find(blockIdx);
+    KU_ASSERT(startState != startStates.end());
+    const auto result = startState->second;
+    startStates.erase(startState);
+    return result;
+}
+
 ParallelCSVReader::ParallelCSVReader(const std::string& filePath, common::idx_t fileIdx,
     CSVOption option, CSVColumnInfo columnInfo, main::ClientContext* context,
-    LocalFileErrorHandler* errorHandler)
+    LocalFileErrorHandler* errorHandler, CSVBlockStartStates* blockStartStates)
     : BaseCSVReader{filePath, fileIdx, std::move(option), std::move(columnInfo), context,
-          errorHandler} {}
+          errorHandler},
+      rowBoundaryScanner{this->option}, blockStartStates{blockStartStates} {}
 
 bool ParallelCSVReader::hasMoreToRead() const {
     // If we haven't started the first block yet or are done our block, get the next block.
@@ -73,6 +108,11 @@ void ParallelCSVReader::seekToBlockStart() {
     }
     osFileOffset = currentBlockIdx * CopyConstants::PARALLEL_BLOCK_SIZE;
 
+    // Scan this block before searching for its first row, so that threads reading later blocks
+    // don't need to scan it themselves.
+    if (!blockStartStates->hasTransition(currentBlockIdx)) {
+        blockStartStates->setTransition(currentBlockIdx, scanBlock(currentBlockIdx));
+    }
     if (currentBlockIdx == 0) {
         // First block doesn't search for a newline.
         return;
@@ -86,31 +126,60 @@ void ParallelCSVReader::seekToBlockStart() {
         return;
     }
 
-    // Find the start of the next line.
+    // Find the start of the next row. A newline in a quoted value doesn't end the row, which
+    // depends on the state the block starts in.
+    auto state = getBlockStartState();
     do {
         for (; position < bufferSize; position++) {
-            if (buffer[position] == '\r') {
+            const auto c = buffer[position];
+            if (rowBoundaryScanner.isRowEnd(state, c)) {
                 position++;
-                if (!maybeReadBuffer(nullptr)) {
-                    return;
+                if (c == '\r') {
+                    if (!maybeReadBuffer(nullptr)) {
+                        return;
+                    }
+                    if (buffer[position] == '\n') {
+                        position++;
+                    }
                 }
-                if (buffer[position] == '\n') {
-                    position++;
-                }
-                return;
-            } else if (buffer[position] == '\n') {
-                position++;
                 return;
             }
+            state = rowBoundaryScanner.step(state, c);
         }
     } while (readBuffer(nullptr));
 }
 
-bool ParallelCSVReader::handleQuotedNewline() {
-    lineContext.setEndOfLine(getFileOffset());
-    handleCopyException("Quoted newlines are not supported in parallel CSV reader."
-                        " Please specify PARALLEL=FALSE in the options.");
-    return false;
+CSVRowBoundaryScanner::State ParallelCSVReader::getBlockStartState() {
+    block_idx_t missingBlockIdx = 0;
+    while (true) {
+        auto state = blockStartStates->takeStartState(currentBlockIdx, missingBlockIdx);
+        if (state.has_value()) {
+            return *state;
+        }
+        // The thread reading the missing block hasn't scanned it yet. Scanning it here is cheaper
+        // than waiting for that thread.
+        blockStartStates->setTransition(missingBlockIdx, scanBlock(missingBlockIdx));
+    }
+}
+
+CSVRowBoundaryScanner::state_transition_t ParallelCSVReader::scanBlock(block_idx_t blockIdx) {
+    const auto blockStart = blockIdx * CopyConstants::PARALLEL_BLOCK_SIZE;
+    const auto fileSize = fileInfo->getFileSize();
+    if (blockStart >= fileSize) {
+        return CSVRowBoundaryScanner::IDENTITY;
+    }
+    const auto size = std::min(CopyConstants::PARALLEL_BLOCK_SIZE, fileSize - blockStart);
+    if (blockData == nullptr) {
+        blockData = std::make_unique<char[]>(CopyConstants::PARALLEL_BLOCK_SIZE);
+    }
+    fileInfo->readFromFile(blockData.get(), size, blockStart);
+    uint64_t offset = 0;
+    if (blockIdx == 0 && size >= 3 && blockData[0] == '\xEF' && blockData[1] == '\xBB' &&
+        blockData[2] == '\xBF') {
+        // Parsing starts after the BOM.
+        offset = 3;
+    }
+    return rowBoundaryScanner.computeTransition(blockData.get() + offset, size - offset);
 }
 
 bool ParallelCSVReader::finishedBlock() const {
@@ -126,8 +195,10 @@ ParallelCSVScanSharedState::ParallelCSVScanSharedState(common::ReaderConfig read
       csvOption{std::move(csvOption)}, columnInfo{std::move(columnInfo)}, numBlocksReadByFiles{0},
       populateErrorFunc(constructPopulateFunc()) {
     errorHandlers.reserve(this->readerConfig.getNumFiles());
+    blockStartStates.reserve(this->readerConfig.getNumFiles());
     for (idx_t i = 0; i < this->readerConfig.getNumFiles(); ++i) {
         errorHandlers.emplace_back(i, &lock, populateErrorFunc);
+        blockStartStates.push_back(std::make_unique<CSVBlockStartStates>());
     }
 }
 
@@ -188,7 +259,8 @@ static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
             localState->reader =
                 std::make_unique<ParallelCSVReader>(sharedState->readerConfig.filePaths[fileIdx],
                     fileIdx, sharedState->csvOption.copy(), sharedState->columnInfo.copy(),
-                    sharedState->context, localState->errorHandler.get());
+                    sharedState->context, localState->errorHandler.get(),
+                    sharedState->blockStartStates[fileIdx].get());
         }
         auto numRowsRead = localState->reader->parseBlock(blockIdx, outputChunk);
 
@@ -263,7 +335,8 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitIn
     for (idx_t i = 0; i < sharedState->readerConfig.getNumFiles(); ++i) {
         auto filePath = sharedState->readerConfig.filePaths[i];
         auto reader = std::make_unique<ParallelCSVReader>(filePath, i, csvOption.copy(),
-            columnInfo.copy(), bindData->context, nullptr);
+            columnInfo.copy(), bindData->context, nullptr /* errorHandler */,
+            nullptr /* blockStartStates */);
         sharedState->totalSize += reader->getFileSize();
     }
 
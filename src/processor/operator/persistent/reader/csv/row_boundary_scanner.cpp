@@ -0,0 +1,123 @@
+#include "processor/operator/persistent/reader/csv/row_boundary_scanner.h"
+
+#include "common/assert.h"
+#include "common/constants.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+CharSetFinder::CharSetFinder(std::initializer_list<char> chars) : chars{}, numChars{0} {
+    KU_ASSERT(chars.size() > 0 && chars.size() <= MAX_NUM_CHARS);
+    for (auto c : chars) {
+        this->chars[numChars++] = c;
+    }
+#if defined(__SSE2__)
+    for (auto i = 0u; i < numChars; i++) {
+        simdChars[i] = _mm_set1_epi8(this->chars[i]);
+    }
+#endif
+}
+
+static bool isNewLine(char c) {
+    return c == '\n' || c == '\r';
+}
+
+CSVRowBoundaryScanner::CSVRowBoundaryScanner(const CSVOption& option)
+    : byteTransitions{}, otherTransition{},
+      specialCharFinder{option.quoteChar, option.escapeChar, option.delimiter, '\n', '\r',
+          CopyConstants::DEFAULT_CSV_LIST_END_CHAR} {
+    for (auto c = 0u; c < byteTransitions.size(); c++) {
+        for (auto s = 0u; s < NUM_STATES; s++) {
+            byteTransitions[c][s] = step(option, static_cast<State>(s), static_cast<char>(c));
+        }
+    }
+    // All bytes that are not special characters have the same transition.
+    for (auto c = 0u; c < byteTransitions.size(); c++) {
+        const auto byte = static_cast<char>(c);
+        if (specialCharFinder.find(&byte, 1) == 1) {
+            otherTransition = byteTransitions[c];
+            break;
+        }
+    }
+}
+
+CSVRowBoundaryScanner::State CSVRowBoundaryScanner::step(const CSVOption& option, State state,
+    char c) {
+    switch (state) {
+    case State::VALUE_START: {
+        if (c == option.quoteChar) {
+            return State::IN_QUOTES;
+        }
+        return step(option, State::NORMAL, c);
+    }
+    case State::NORMAL: {
+        if (c == option.delimiter || isNewLine(c)) {
+            return State::VALUE_START;
+        }
+        return State::NORMAL;
+    }
+    case State::IN_QUOTES: {
+        if (c == option.quoteChar) {
+            return State::UNQUOTE;
+        }
+        if (c == option.escapeChar) {
+            return State::ESCAPE;
+        }
+        return State::IN_QUOTES;
+    }
+    case State::UNQUOTE: {
+        if (c == option.quoteChar &&
+            (!option.escapeChar || option.escapeChar == option.quoteChar)) {
+            return State::IN_QUOTES;
+        }
+        if (c == option.delimiter || c == CopyConstants::DEFAULT_CSV_LIST_END_CHAR ||
+            isNewLine(c)) {
+            return State::VALUE_START;
+        }
+        // The parser reports the malformed value and skips the line.
+        return State::SKIP_LINE;
+    }
+    case State::ESCAPE: {
+        if (c == option.quoteChar || c == option.escapeChar) {
+            return State::IN_QUOTES;
+        }
+        // The parser consumes the invalid character, even a newline, and skips the line.
+        return State::SKIP_LINE;
+    }
+    case State::SKIP_LINE: {
+        return isNewLine(c) ? State::VALUE_START : State::SKIP_LINE;
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+static void applyInPlace(CSVRowBoundaryScanner::state_transition_t& result,
+    const CSVRowBoundaryScanner::state_transition_t& transition) {
+    for (auto& state : result) {
+        state = CSVRowBoundaryScanner::apply(transition, state);
+    }
+}
+
+CSVRowBoundaryScanner::state_transition_t CSVRowBoundaryScanner::computeTransition(
+    const char* data, uint64_t size) const {
+    auto result = IDENTITY;
+    uint64_t offset = 0;
+    while (offset < size) {
+        const auto next = offset + specialCharFinder.find(data + offset, size - offset);
+        if (next > offset) {
+            applyInPlace(result, otherTransition);
+        }
+        if (next == size) {
+            break;
+        }
+        applyInPlace(result, byteTransitions[static_cast<uint8_t>(data[next])]);
+        offset = next + 1;
+    }
+    return result;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "processor/operator/persistent/reader/parquet/parquet_reader.h"
 
+#include <cmath>
+
 #include "common/exception/binder.h"
 #include "common/exception/copy.h"
 #include "common/file_system/virtual_file_system.h"
@@ -7,9 +9,11 @@
 #include "function/table/bind_data.h"
 #include "processor/execution_context.h"
 #include "processor/operator/persistent/reader/parquet/list_column_reader.h"
+#include "processor/operator/persistent/reader/parquet/parquet_timestamp.h"
 #include "processor/operator/persistent/reader/parquet/struct_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/thrift_tools.h"
 #include "processor/operator/persistent/reader/reader_bind_utils.h"
+#include "storage/compression/compression.h"
 
 using namespace kuzu_parquet::format;
 
@@ -23,6 +27,7 @@ ParquetReader::ParquetReader(const std::string& filePath, std::vector<bool> colu
     main::ClientContext* context)
     : filePath{filePath}, columnSkips(std::move(columnSkips)), context{context} {
     initMetadata();
+    initColumns();
 }
 
 void ParquetReader::initializeScan(ParquetReaderScanState& state,
@@ -61,10 +66,12 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
             return false;
         }
 
+        prepareRowGroupBuffer(state);
         uint64_t toScanCompressedBytes = 0;
         for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
-            prepareRowGroupBuffer(state, colIdx);
-
+            if (!columnSkips.empty() && columnSkips[colIdx]) {
+                continue;
+            }
             auto fileColIdx = colIdx;
 
             auto rootReader = ku_dynamic_cast<StructColumnReader*>(state.rootReader.get());
@@ -98,6 +105,9 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
             } else {
                 // Prefetch column-wise.
                 for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
+                    if (!columnSkips.empty() && columnSkips[colIdx]) {
+                        continue;
+                    }
                     auto fileColIdx = colIdx;
                     auto rootReader = ku_dynamic_cast<StructColumnReader*>(state.rootReader.get());
 
@@ -332,18 +342,189 @@ std::unique_ptr<ColumnReader> ParquetReader::createReader() {
         throw CopyException{"Root element of Parquet file must be a struct"};
     }
     // LCOV_EXCL_STOP
+    KU_ASSERT(nextSchemaIdx == metadata->schema.size() - 1);
+    KU_ASSERT(
+        metadata->row_groups.empty() || nextFileIdx == metadata->row_groups[0].columns.size());
+    return rootReader;
+}
+
+// Returns the index of the schema element after the subtree rooted at schemaIdx, and counts the
+// leaves of the subtree. Each leaf is stored in its own column chunk.
+static uint64_t skipSchemaSubtree(const std::vector<SchemaElement>& schema, uint64_t schemaIdx,
+    uint64_t& numLeaves) {
+    KU_ASSERT(schemaIdx < schema.size());
+    auto& element = schema[schemaIdx++];
+    if (!element.__isset.num_children || element.num_children == 0) {
+        numLeaves++;
+        return schemaIdx;
+    }
+    for (auto i = 0; i < element.num_children; i++) {
+        schemaIdx = skipSchemaSubtree(schema, schemaIdx, numLeaves);
+    }
+    return schemaIdx;
+}
+
+void ParquetReader::initColumns() {
+    auto rootReader = createReader();
     for (auto& field : StructType::getFields(rootReader->getDataType())) {
         columnNames.push_back(field.getName());
         columnTypes.push_back(field.getType().copy());
     }
+    uint64_t schemaIdx = 1;
+    uint64_t numLeaves = 0;
+    for (auto i = 0u; i < columnNames.size(); i++) {
+        auto& element = metadata->schema[schemaIdx];
+        auto isNested = (element.__isset.num_children && element.num_children > 0) ||
+                        (element.__isset.repetition_type &&
+                            element.repetition_type == FieldRepetitionType::REPEATED);
+        columnSchemaIdxes.push_back(schemaIdx);
+        columnChunkIdxes.push_back(isNested ? INVALID_COLUMN_ID : numLeaves);
+        schemaIdx = skipSchemaSubtree(metadata->schema, schemaIdx, numLeaves);
+    }
+}
 
-    KU_ASSERT(nextSchemaIdx == metadata->schema.size() - 1);
-    KU_ASSERT(
-        metadata->row_groups.empty() || nextFileIdx == metadata->row_groups[0].columns.size());
-    return rootReader;
+template<typename T>
+static T readStatistic(const std::string& bytes) {
+    T result;
+    KU_ASSERT(bytes.size() == sizeof(T));
+    memcpy(&result, bytes.data(), sizeof(T));
+    return result;
+}
+
+template<typename T>
+static std::optional<std::pair<T, T>> readMinMax(const Statistics& statistics,
+    bool allowDeprecatedMinMax) {
+    // The deprecated min and max use signed comparison regardless of the logical type.
+    if (statistics.__isset.min_value && statistics.__isset.max_value) {
+        if (statistics.min_value.size() != sizeof(T) || statistics.max_value.size() != sizeof(T)) {
+            return std::nullopt;
+        }
+        return std::make_pair(readStatistic<T>(statistics.min_value),
+            readStatistic<T>(statistics.max_value));
+    }
+    if (allowDeprecatedMinMax && statistics.__isset.min && statistics.__isset.max) {
+        if (statistics.min.size() != sizeof(T) || statistics.max.size() != sizeof(T)) {
+            return std::nullopt;
+        }
+        return std::make_pair(readStatistic<T>(statistics.min), readStatistic<T>(statistics.max));
+    }
+    return std::nullopt;
+}
+
+static storage::CompressionMetadata createZoneMap(storage::StorageValue min,
+    storage::StorageValue max) {
+    return storage::CompressionMetadata(min, max, storage::CompressionType::UNCOMPRESSED);
+}
+
+template<typename T>
+static std::optional<storage::CompressionMetadata> getZoneMap(const Statistics& statistics,
+    bool allowDeprecatedMinMax = true) {
+    auto minMax = readMinMax<T>(statistics, allowDeprecatedMinMax);
+    if (!minMax) {
+        return std::nullopt;
+    }
+    auto [min, max] = *minMax;
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(min) || std::isnan(max)) {
+            return std::nullopt;
+        }
+    }
+    return createZoneMap(storage::StorageValue(min), storage::StorageValue(max));
 }
 
-void ParquetReader::prepareRowGroupBuffer(ParquetReaderScanState& state, uint64_t /*colIdx*/) {
+// Returns the min and max of a column chunk as the zone map of a column of the given type, or
+// nullopt if the chunk has no usable statistics.
+static std::optional<storage::CompressionMetadata> getZoneMap(const ColumnChunk& chunk,
+    const SchemaElement& element, const LogicalType& type) {
+    if (!chunk.meta_data.__isset.statistics) {
+        return std::nullopt;
+    }
+    auto& statistics = chunk.meta_data.statistics;
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::DATE: {
+        return getZoneMap<int32_t>(statistics);
+    }
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32: {
+        return getZoneMap<uint32_t>(statistics, false /* allowDeprecatedMinMax */);
+    }
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::SERIAL: {
+        return getZoneMap<int64_t>(statistics);
+    }
+    case LogicalTypeID::UINT64: {
+        return getZoneMap<uint64_t>(statistics, false /* allowDeprecatedMinMax */);
+    }
+    case LogicalTypeID::FLOAT: {
+        return getZoneMap<float>(statistics);
+    }
+    case LogicalTypeID::DOUBLE: {
+        return getZoneMap<double>(statistics);
+    }
+    case LogicalTypeID::TIMESTAMP: {
+        if (element.type != Type::INT64) {
+            return std::nullopt;
+        }
+        auto convert = &ParquetTimeStampUtils::parquetTimestampMicrosToTimestamp;
+        if (element.__isset.logicalType && element.logicalType.__isset.TIMESTAMP) {
+            auto& unit = element.logicalType.TIMESTAMP.unit;
+            if (unit.__isset.MILLIS) {
+                convert = &ParquetTimeStampUtils::parquetTimestampMsToTimestamp;
+            } else if (unit.__isset.NANOS) {
+                convert = &ParquetTimeStampUtils::parquetTimestampNsToTimestamp;
+            }
+        } else if (element.__isset.converted_type &&
+                   element.converted_type == ConvertedType::TIMESTAMP_MILLIS) {
+            convert = &ParquetTimeStampUtils::parquetTimestampMsToTimestamp;
+        }
+        auto minMax = readMinMax<int64_t>(statistics, true /* allowDeprecatedMinMax */);
+        if (!minMax) {
+            return std::nullopt;
+        }
+        // The conversions are monotonic, so they preserve the bounds.
+        return createZoneMap(storage::StorageValue(convert(minMax->first).value),
+            storage::StorageValue(convert(minMax->second).value));
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<storage::ColumnPredicateSet>& columnPredicates) const {
+    KU_ASSERT(groupIdx < metadata->row_groups.size());
+    auto& group = metadata->row_groups[groupIdx];
+    for (auto colIdx = 0u; colIdx < columnPredicates.size() && colIdx < columnNames.size();
+         colIdx++) {
+        if (columnPredicates[colIdx].isEmpty() || columnChunkIdxes[colIdx] == INVALID_COLUMN_ID) {
+            continue;
+        }
+        auto& chunk = group.columns[columnChunkIdxes[colIdx]];
+        auto& statistics = chunk.meta_data.statistics;
+        // Comparisons with null are never true, so a chunk of nulls has no matching rows. Files
+        // written by older versions of Kuzu overcount nulls, so a chunk with a min or max still
+        // holds values.
+        auto hasMinMax = statistics.__isset.min_value || statistics.__isset.max_value ||
+                         statistics.__isset.min || statistics.__isset.max;
+        if (chunk.meta_data.__isset.statistics && statistics.__isset.null_count &&
+            statistics.null_count == chunk.meta_data.num_values && !hasMinMax) {
+            return true;
+        }
+        auto zoneMap = getZoneMap(chunk, metadata->schema[columnSchemaIdxes[colIdx]],
+            columnTypes[colIdx]);
+        if (zoneMap &&
+            columnPredicates[colIdx].checkZoneMap(*zoneMap) == ZoneMapCheckResult::SKIP_SCAN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ParquetReader::prepareRowGroupBuffer(ParquetReaderScanState& state) {
     auto& group = getGroup(state);
     state.rootReader->initializeRead(state.groupIdxList[state.currentGroup], group.columns,
         *state.thriftFileProto);
@@ -573,47 +754,35 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
     return minOffset;
 }
 
-ParquetScanSharedState::ParquetScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
-    main::ClientContext* context, std::vector<bool> columnSkips)
-    : ScanFileSharedState{std::move(readerConfig), numRows, context}, columnSkips{columnSkips} {
-    readers.push_back(std::make_unique<ParquetReader>(this->readerConfig.filePaths[fileIdx],
-        columnSkips, context));
-    totalRowsGroups = 0;
-    for (auto i = fileIdx; i < this->readerConfig.getNumFiles(); i++) {
+ParquetScanSharedState::ParquetScanSharedState(common::ReaderConfig readerConfig,
+    main::ClientContext* context, std::vector<bool> columnSkips,
+    const std::vector<storage::ColumnPredicateSet>& columnPredicates)
+    : ScanFileSharedState{std::move(readerConfig), 0 /* numRows */, context},
+      nextRowGroupIdx{0} {
+    for (auto i = 0u; i < this->readerConfig.getNumFiles(); i++) {
         auto reader =
             std::make_unique<ParquetReader>(this->readerConfig.filePaths[i], columnSkips, context);
-        totalRowsGroups += reader->getNumRowsGroups();
+        numRows += reader->getMetadata()->num_rows;
+        for (auto groupIdx = 0u; groupIdx < reader->getNumRowsGroups(); groupIdx++) {
+            if (!reader->canSkipRowGroup(groupIdx, columnPredicates)) {
+                rowGroupsToScan.push_back({i, groupIdx});
+            }
+        }
+        readers.push_back(std::move(reader));
     }
-    numBlocksReadByFiles = 0;
 }
 
 static bool parquetSharedStateNext(ParquetScanLocalState& localState,
     ParquetScanSharedState& sharedState) {
-    std::lock_guard<std::mutex> mtx{sharedState.lock};
-    while (true) {
-        if (sharedState.fileIdx >= sharedState.readerConfig.getNumFiles()) {
-            return false;
-        }
-        if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
-            localState.reader = sharedState.readers[sharedState.fileIdx].get();
-            localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
-                sharedState.context->getVFSUnsafe());
-            sharedState.blockIdx++;
-            return true;
-        } else {
-            sharedState.numBlocksReadByFiles +=
-                sharedState.readers[sharedState.fileIdx]->getNumRowsGroups();
-            sharedState.blockIdx = 0;
-            sharedState.fileIdx++;
-            if (sharedState.fileIdx >= sharedState.readerConfig.getNumFiles()) {
-                return false;
-            }
-            sharedState.readers.push_back(std::make_unique<ParquetReader>(
-                sharedState.readerConfig.filePaths[sharedState.fileIdx], sharedState.columnSkips,
-                sharedState.context));
-            continue;
-        }
+    auto rowGroupIdx = sharedState.nextRowGroupIdx.fetch_add(1, std::memory_order_relaxed);
+    if (rowGroupIdx >= sharedState.rowGroupsToScan.size()) {
+        return false;
     }
+    auto& rowGroup = sharedState.rowGroupsToScan[rowGroupIdx];
+    localState.reader = sharedState.readers[rowGroup.fileIdx].get();
+    localState.reader->initializeScan(*localState.state, {rowGroup.groupIdx},
+        sharedState.context->getVFSUnsafe());
+    return true;
 }
 
 static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
@@ -680,14 +849,8 @@ static std::unique_ptr<function::TableFuncBindData> bindFunc(main::ClientContext
 static std::unique_ptr<function::TableFuncSharedState> initSharedState(
     TableFunctionInitInput& input) {
     auto bindData = input.bindData->constPtrCast<ScanBindData>();
-    row_idx_t numRows = 0;
-    for (const auto& path : bindData->config.filePaths) {
-        auto reader =
-            std::make_unique<ParquetReader>(path, bindData->getColumnSkips(), bindData->context);
-        numRows += reader->getMetadata()->num_rows;
-    }
-    return std::make_unique<ParquetScanSharedState>(bindData->config.copy(), numRows,
-        bindData->context, bindData->getColumnSkips());
+    return std::make_unique<ParquetScanSharedState>(bindData->config.copy(), bindData->context,
+        bindData->getColumnSkips(), bindData->getColumnPredicates());
 }
 
 static std::unique_ptr<function::TableFuncLocalState> initLocalState(
@@ -703,14 +866,12 @@ static std::unique_ptr<function::TableFuncLocalState> initLocalState(
 
 static double progressFunc(TableFuncSharedState* sharedState) {
     auto state = sharedState->ptrCast<ParquetScanSharedState>();
-    if (state->fileIdx >= state->readerConfig.getNumFiles()) {
+    if (state->rowGroupsToScan.empty()) {
         return 1.0;
     }
-    if (state->totalRowsGroups == 0) {
-        return 0.0;
-    }
-    uint64_t totalReadSize = state->numBlocksReadByFiles + state->blockIdx;
-    return static_cast<double>(totalReadSize) / state->totalRowsGroups;
+    auto numRowGroupsClaimed = std::min<uint64_t>(state->nextRowGroupIdx.load(),
+        state->rowGroupsToScan.size());
+    return static_cast<double>(numRowGroupsClaimed) / state->rowGroupsToScan.size();
 }
 
 static void finalizeFunc(ExecutionContext* ctx, TableFuncSharedState*, TableFuncLocalState*) {
@@ -1,5 +1,9 @@
 #include "processor/operator/persistent/rel_batch_insert.h"
 
+#include <algorithm>
+#include <tuple>
+
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "common/exception/copy.h"
 #include "common/exception/message.h"
 #include "common/string_format.h"
@@ -146,10 +150,15 @@ void RelBatchInsert::populateCSRHeaderAndRowIdx(InMemChunkedNodeGroupCollection&
     const auto csrChunkCapacity = rightCSROffsetOfRegions.back() + 1;
     localState.chunkedGroup->resizeChunks(csrChunkCapacity);
     localState.chunkedGroup->resetToAllNull();
-    for (auto& chunkedGroup : partition.getChunkedGroups()) {
-        auto& offsetChunk = chunkedGroup->getColumnChunk(relInfo.boundNodeOffsetColumnID);
-        // We reuse bound node offset column to store row idx for each rel in the node group.
-        setRowIdxFromCSROffsets(offsetChunk.getData(), csrHeader.offset->getData());
+    // We reuse bound node offset column to store row idx for each rel in the node group.
+    if (relInfo.tableEntry->constCast<RelTableCatalogEntry>().hasSortedAdjacencyLists()) {
+        setRowIdxSortedByNbrOffset(partition, relInfo.boundNodeOffsetColumnID,
+            csrHeader.offset->getData());
+    } else {
+        for (auto& chunkedGroup : partition.getChunkedGroups()) {
+            auto& offsetChunk = chunkedGroup->getColumnChunk(relInfo.boundNodeOffsetColumnID);
+            setRowIdxFromCSROffsets(offsetChunk.getData(), csrHeader.offset->getData());
+        }
     }
     csrHeader.finalizeCSRRegionEndOffsets(rightCSROffsetOfRegions);
     KU_ASSERT(csrHeader.sanityCheck());
@@ -191,6 +200,43 @@ void RelBatchInsert::setRowIdxFromCSROffsets(ColumnChunkData& rowIdxChunk,
     }
 }
 
+void RelBatchInsert::setRowIdxSortedByNbrOffset(InMemChunkedNodeGroupCollection& partition,
+    column_id_t boundNodeOffsetColumn, ColumnChunkData& csrOffsetChunk) {
+    struct RelToPlace {
+        offset_t boundNodeOffset;
+        offset_t nbrNodeOffset;
+        uint64_t chunkIdx;
+        uint64_t posInChunk;
+
+        bool operator<(const RelToPlace& other) const {
+            return std::tie(boundNodeOffset, nbrNodeOffset, chunkIdx, posInChunk) <
+                   std::tie(other.boundNodeOffset, other.nbrNodeOffset, other.chunkIdx,
+                       other.posInChunk);
+        }
+    };
+    // The partition holds the offsets of both bound and neighbour nodes.
+    const column_id_t nbrNodeOffsetColumn = boundNodeOffsetColumn == 0 ? 1 : 0;
+    auto& chunkedGroups = partition.getChunkedGroups();
+    std::vector<RelToPlace> rels;
+    for (auto chunkIdx = 0u; chunkIdx < chunkedGroups.size(); chunkIdx++) {
+        auto& boundChunk = chunkedGroups[chunkIdx]->getColumnChunk(boundNodeOffsetColumn).getData();
+        auto& nbrChunk = chunkedGroups[chunkIdx]->getColumnChunk(nbrNodeOffsetColumn).getData();
+        for (auto i = 0u; i < boundChunk.getNumValues(); i++) {
+            rels.push_back({boundChunk.getValue<offset_t>(i), nbrChunk.getValue<offset_t>(i),
+                chunkIdx, i});
+        }
+    }
+    std::sort(rels.begin(), rels.end());
+    for (auto& rel : rels) {
+        const auto csrOffset = csrOffsetChunk.getValue<offset_t>(rel.boundNodeOffset);
+        chunkedGroups[rel.chunkIdx]
+            ->getColumnChunk(boundNodeOffsetColumn)
+            .getData()
+            .setValue<offset_t>(csrOffset, rel.posInChunk);
+        csrOffsetChunk.setValue<offset_t>(csrOffset + 1, rel.boundNodeOffset);
+    }
+}
+
 void RelBatchInsert::checkRelMultiplicityConstraint(const ChunkedCSRHeader& csrHeader,
     offset_t startNodeOffset, const RelBatchInsertInfo& relInfo) {
     auto& relTableEntry = relInfo.tableEntry->constCast<RelTableCatalogEntry>();
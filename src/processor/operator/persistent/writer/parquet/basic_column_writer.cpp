@@ -5,6 +5,7 @@
 #include "processor/operator/persistent/reader/parquet/parquet_rle_bp_decoder.h"
 #include "processor/operator/persistent/writer//parquet/parquet_rle_bp_encoder.h"
 #include "processor/operator/persistent/writer/parquet/parquet_writer.h"
+#include "thrift/protocol/TCompactProtocol.h"
 
 namespace kuzu {
 namespace processor {
@@ -115,44 +116,66 @@ void BasicColumnWriter::write(ColumnWriterState& writerState, common::ValueVecto
     }
 }
 
-void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+void BasicColumnWriter::finalizePages(ColumnWriterState& writerState) {
     auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
     auto& columnChunk = state.rowGroup.columns[state.colIdx];
 
     // Flush the last page (if any remains).
     flushPage(state);
 
-    auto startOffset = writer.getOffset();
-    auto pageOffset = startOffset;
     // Flush the dictionary.
     if (hasDictionary(state)) {
         columnChunk.meta_data.statistics.distinct_count = dictionarySize(state);
         columnChunk.meta_data.statistics.__isset.distinct_count = true;
-        columnChunk.meta_data.dictionary_page_offset = pageOffset;
-        columnChunk.meta_data.__isset.dictionary_page_offset = true;
         flushDictionary(state, state.statsState.get());
-        pageOffset += state.writeInfo[0].compressedSize;
     }
-
-    // Record the start position of the pages for this column.
-    columnChunk.meta_data.data_page_offset = pageOffset;
     setParquetStatistics(state, columnChunk);
 
-    // write the individual pages to disk
+    // Serialize the pages with their headers, so that writing the column chunk to the file only
+    // appends bytes.
+    state.chunkData = std::make_unique<BufferedSerializer>();
+    kuzu_apache::thrift::protocol::TCompactProtocolFactoryT<ParquetWriterBufferTransport>
+        tprotoFactory;
+    auto protocol =
+        tprotoFactory.getProtocol(std::make_shared<ParquetWriterBufferTransport>(*state.chunkData));
     uint64_t totalUncompressedSize = 0;
-    for (auto& write_info : state.writeInfo) {
+    for (auto i = 0u; i < state.writeInfo.size(); i++) {
+        auto& write_info = state.writeInfo[i];
         KU_ASSERT(write_info.pageHeader.uncompressed_page_size > 0);
-        auto header_start_offset = writer.getOffset();
-        write_info.pageHeader.write(writer.getProtocol());
+        if (i == 1 && hasDictionary(state)) {
+            state.dataPageOffset = state.chunkData->getSize();
+        }
+        auto header_start_offset = state.chunkData->getSize();
+        write_info.pageHeader.write(protocol.get());
         // total uncompressed size in the column chunk includes the header size (!)
-        totalUncompressedSize += writer.getOffset() - header_start_offset;
+        totalUncompressedSize += state.chunkData->getSize() - header_start_offset;
         totalUncompressedSize += write_info.pageHeader.uncompressed_page_size;
-        writer.write(write_info.compressedData, write_info.compressedSize);
+        state.chunkData->write(write_info.compressedData, write_info.compressedSize);
+        // The page has been copied into the column chunk.
+        write_info.compressedBuf.reset();
+        write_info.bufferWriter.reset();
+        write_info.compressedData = nullptr;
     }
-    columnChunk.meta_data.total_compressed_size = writer.getOffset() - startOffset;
+    columnChunk.meta_data.total_compressed_size = state.chunkData->getSize();
     columnChunk.meta_data.total_uncompressed_size = totalUncompressedSize;
 }
 
+void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+    auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
+    auto& columnChunk = state.rowGroup.columns[state.colIdx];
+    KU_ASSERT(state.chunkData != nullptr);
+
+    // Record the start position of the pages for this column.
+    auto startOffset = writer.getOffset();
+    if (hasDictionary(state)) {
+        columnChunk.meta_data.dictionary_page_offset = startOffset;
+        columnChunk.meta_data.__isset.dictionary_page_offset = true;
+    }
+    columnChunk.meta_data.data_page_offset = startOffset + state.dataPageOffset;
+    writer.write(state.chunkData->getBlobData(), state.chunkData->getSize());
+    state.chunkData.reset();
+}
+
 void BasicColumnWriter::writeLevels(Serializer& serializer, const std::vector<uint16_t>& levels,
     uint64_t maxValue, uint64_t startOffset, uint64_t count) {
     if (levels.empty() || count == 0) {
@@ -269,7 +292,7 @@ void BasicColumnWriter::writeDictionary(BasicColumnWriterState& state,
 void BasicColumnWriter::setParquetStatistics(BasicColumnWriterState& state,
     kuzu_parquet::format::ColumnChunk& column) {
     if (maxRepeat == 0) {
-        column.meta_data.statistics.null_count = nullCount;
+        column.meta_data.statistics.null_count = state.nullCount;
         column.meta_data.statistics.__isset.null_count = true;
         column.meta_data.__isset.statistics = true;
     }
@@ -20,10 +20,14 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "ATTACH_DATABASE";
     case PhysicalOperatorType::BATCH_INSERT:
         return "BATCH_INSERT";
+    case PhysicalOperatorType::BLOOM_FILTER_PROBE:
+        return "BLOOM_FILTER_PROBE";
     case PhysicalOperatorType::COPY_RDF:
         return "COPY_RDF";
     case PhysicalOperatorType::COPY_TO:
         return "COPY_TO";
+    case PhysicalOperatorType::COUNT_REL_TABLE:
+        return "COUNT_REL_TABLE";
     case PhysicalOperatorType::CREATE_MACRO:
         return "CREATE_MACRO";
     case PhysicalOperatorType::CREATE_SEQUENCE:
@@ -44,6 +48,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "EMPTY_RESULT";
     case PhysicalOperatorType::EXPORT_DATABASE:
         return "EXPORT_DATABASE";
+    case PhysicalOperatorType::FETCH_NODE_PROPERTY:
+        return "FETCH_NODE_PROPERTY";
     case PhysicalOperatorType::FILTER:
         return "FILTER";
     case PhysicalOperatorType::FLATTEN:
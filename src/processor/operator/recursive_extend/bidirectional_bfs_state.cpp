@@ -0,0 +1,84 @@
+#include "processor/operator/recursive_extend/bidirectional_bfs_state.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void BFSSide::resetState(nodeID_t startNodeID) {
+    currentLevel = 0;
+    currentFrontier.clear();
+    nextFrontier.clear();
+    parents.clear();
+    currentFrontier.push_back(startNodeID);
+    parents.insert({startNodeID, {nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID}, relID_t{}}});
+}
+
+bool BFSSide::markVisited(nodeID_t boundNodeID, nodeID_t nbrNodeID, relID_t relID) {
+    if (!parents.insert({nbrNodeID, {boundNodeID, relID}}).second) {
+        return false;
+    }
+    nextFrontier.push_back(nbrNodeID);
+    return true;
+}
+
+void BFSSide::finalizeCurrentLevel() {
+    std::swap(currentFrontier, nextFrontier);
+    nextFrontier.clear();
+    currentLevel++;
+    std::sort(currentFrontier.begin(), currentFrontier.end());
+}
+
+void BFSSide::appendPathToStart(nodeID_t nodeID, std::vector<nodeID_t>& nodeIDs,
+    std::vector<relID_t>& relIDs) const {
+    nodeIDs.push_back(nodeID);
+    auto parent = parents.at(nodeID);
+    while (parent.first.offset != INVALID_OFFSET) {
+        relIDs.push_back(parent.second);
+        nodeIDs.push_back(parent.first);
+        parent = parents.at(parent.first);
+    }
+}
+
+void BidirectionalBFSState::resetState(nodeID_t srcNodeID, nodeID_t dstNodeID) {
+    srcSide.resetState(srcNodeID);
+    dstSide.resetState(dstNodeID);
+    pathFound = false;
+    pathNodeIDs.clear();
+    pathRelIDs.clear();
+}
+
+bool BidirectionalBFSState::isComplete() const {
+    return pathFound || srcSide.getCurrentFrontier().empty() ||
+           dstSide.getCurrentFrontier().empty() ||
+           srcSide.getCurrentLevel() + dstSide.getCurrentLevel() >= upperBound;
+}
+
+bool BidirectionalBFSState::markVisited(bool fromSrc, nodeID_t boundNodeID, nodeID_t nbrNodeID,
+    relID_t relID) {
+    auto& side = getSide(fromSrc);
+    auto& otherSide = getSide(!fromSrc);
+    if (!side.markVisited(boundNodeID, nbrNodeID, relID) || !otherSide.isVisited(nbrNodeID)) {
+        return false;
+    }
+    // The path goes from the src to srcSideNodeID, then through relID to dstSideNodeID and on to
+    // the dst.
+    auto srcSideNodeID = fromSrc ? boundNodeID : nbrNodeID;
+    auto dstSideNodeID = fromSrc ? nbrNodeID : boundNodeID;
+    srcSide.appendPathToStart(srcSideNodeID, pathNodeIDs, pathRelIDs);
+    std::reverse(pathNodeIDs.begin(), pathNodeIDs.end());
+    std::reverse(pathRelIDs.begin(), pathRelIDs.end());
+    pathRelIDs.push_back(relID);
+    dstSide.appendPathToStart(dstSideNodeID, pathNodeIDs, pathRelIDs);
+    pathFound = true;
+    return true;
+}
+
+void BidirectionalBFSState::writePath(BaseBFSState& bfsState, bool trackPath) const {
+    if (pathFound) {
+        bfsState.setPath(pathNodeIDs, pathRelIDs, trackPath);
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,61 @@
+#include "processor/operator/recursive_extend/frontier_morsel_dispatcher.h"
+
+#include <algorithm>
+
+namespace kuzu {
+namespace processor {
+
+void SharedFrontiers::startBFS() {
+    std::unique_lock lck{mtx};
+    numRunningBFS++;
+}
+
+void SharedFrontiers::finishBFS() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numRunningBFS > 0);
+    numRunningBFS--;
+    cv.notify_all();
+}
+
+void SharedFrontiers::publish(FrontierMorselDispatcher* dispatcher) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(dispatcher->numHelpers == 0);
+    dispatchers.push_back(dispatcher);
+    cv.notify_all();
+}
+
+void SharedFrontiers::unpublish(FrontierMorselDispatcher* dispatcher) {
+    std::unique_lock lck{mtx};
+    dispatchers.erase(std::find(dispatchers.begin(), dispatchers.end(), dispatcher));
+    // Helpers may still be extending the last morsels they got.
+    cv.wait(lck, [&] { return dispatcher->numHelpers == 0; });
+}
+
+FrontierMorselDispatcher* SharedFrontiers::acquire() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return numRunningBFS == 0 || getDispatcherWithMorsels() != nullptr; });
+    auto dispatcher = getDispatcherWithMorsels();
+    if (dispatcher != nullptr) {
+        dispatcher->numHelpers++;
+    }
+    return dispatcher;
+}
+
+void SharedFrontiers::release(FrontierMorselDispatcher* dispatcher) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(dispatcher->numHelpers > 0);
+    dispatcher->numHelpers--;
+    cv.notify_all();
+}
+
+FrontierMorselDispatcher* SharedFrontiers::getDispatcherWithMorsels() const {
+    for (auto dispatcher : dispatchers) {
+        if (dispatcher->hasMoreMorsels()) {
+            return dispatcher;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -4,6 +4,8 @@
 #include "processor/operator/recursive_extend/shortest_path_state.h"
 #include "processor/operator/recursive_extend/variable_length_state.h"
 #include "processor/operator/scan/offset_scan_node_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/table.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -19,6 +21,16 @@ std::vector<NodeSemiMask*> RecursiveJoin::getSemiMask() const {
     return result;
 }
 
+static table_id_map_t<offset_t> getNumNodesPerTable(const ExecutionContext* context,
+    const RecursiveJoinDataInfo& dataInfo) {
+    table_id_map_t<offset_t> result;
+    auto storageManager = context->clientContext->getStorageManager();
+    for (auto tableID : dataInfo.recursiveDstNodeTableIDs) {
+        result.insert({tableID, storageManager->getTable(tableID)->getNumRows()});
+    }
+    return result;
+}
+
 void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context) {
     auto& dataInfo = info.dataInfo;
     populateTargetDstNodes(context);
@@ -79,7 +91,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo.pathPos).get();
             bfsState = std::make_unique<ShortestPathState<true /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), getNumNodesPerTable(context, dataInfo));
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
                     dataInfo.tableIDToName, nullptr, info.direction, info.extendFromSource));
@@ -87,7 +99,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
             bfsState = std::make_unique<ShortestPathState<false /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), getNumNodesPerTable(context, dataInfo));
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -164,7 +176,15 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
             StructVector::getFieldVector(pathRelsDataVector, pathRelsLabelFieldIdx).get();
     }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
+    if (context->clientContext->getClientConfig()->numThreads > 1) {
+        frontierDispatcher = std::make_unique<FrontierMorselDispatcher>();
+    }
     initLocalRecursivePlan(context);
+    if (reverseRecursiveRoot != nullptr) {
+        KU_ASSERT(info.queryRelType == QueryRelType::SHORTEST);
+        bidirectionalBFSState = std::make_unique<BidirectionalBFSState>(upperBound);
+        initLocalReverseRecursivePlan(context);
+    }
 }
 
 bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
@@ -187,6 +207,8 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
             return true;
         }
         if (!children[0]->getNextTuple(context)) {
+            // Threads without sources left help the ones still computing a BFS.
+            helpComputeBFS(context);
             return false;
         }
         bfsState->resetState();
@@ -213,26 +235,104 @@ bool RecursiveJoin::scanOutput() {
 void RecursiveJoin::computeBFS(ExecutionContext* context) {
     auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
         vectors->srcNodeIDVector->state->getSelVector()[0]);
+    if (bidirectionalBFSState != nullptr) {
+        auto dstNodeID = targetDstNodes->getSingleNodeID();
+        if (dstNodeID.offset != INVALID_OFFSET && dstNodeID != nodeID &&
+            info.dataInfo.recursiveDstNodeTableIDs.contains(dstNodeID.tableID)) {
+            computeBidirectionalBFS(context, nodeID, dstNodeID);
+            return;
+        }
+    }
     bfsState->markSrc(nodeID);
     vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, true);
-    while (!bfsState->isComplete()) {
-        auto boundNodeID = bfsState->getNextNodeID();
-        if (boundNodeID.offset != INVALID_OFFSET) {
-            // Found a starting node from current frontier.
-            recursiveSource->init(boundNodeID);
-            while (recursiveRoot->getNextTuple(context)) { // Exhaust recursive plan.
-                updateVisitedNodes(boundNodeID);
+    if (frontierDispatcher) {
+        sharedState->frontiers.startBFS();
+    }
+    try {
+        while (!bfsState->isComplete()) {
+            if (frontierDispatcher && bfsState->isAtStartOfLevel() &&
+                bfsState->getCurrentFrontier()->nodeIDs.size() >=
+                    FrontierMorselDispatcher::MIN_FRONTIER_SIZE_TO_SHARE) {
+                computeLevelInParallel(context);
+                bfsState->finalizeCurrentLevel();
+                vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, false);
+                continue;
             }
-        } else {
-            // Otherwise move to the next frontier.
-            bfsState->finalizeCurrentLevel();
-            vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, false);
+            auto boundNodeID = bfsState->getNextNodeID();
+            if (boundNodeID.offset != INVALID_OFFSET) {
+                // Found a starting node from current frontier.
+                extend(context, *bfsState, boundNodeID, false /* concurrently */);
+            } else {
+                // Otherwise move to the next frontier.
+                bfsState->finalizeCurrentLevel();
+                vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, false);
+            }
+        }
+    } catch (...) {
+        if (frontierDispatcher) {
+            sharedState->frontiers.finishBFS();
+        }
+        throw;
+    }
+    if (frontierDispatcher) {
+        sharedState->frontiers.finishBFS();
+    }
+}
+
+void RecursiveJoin::computeLevelInParallel(ExecutionContext* context) {
+    const auto isFirstLevel =
+        vectors->recursiveNodePredicateExecFlagVector->getValue<bool>(0 /* pos */);
+    frontierDispatcher->init(bfsState.get(), isFirstLevel);
+    sharedState->frontiers.publish(frontierDispatcher.get());
+    try {
+        extendFrontierMorsels(context, *frontierDispatcher);
+    } catch (...) {
+        sharedState->frontiers.unpublish(frontierDispatcher.get());
+        throw;
+    }
+    sharedState->frontiers.unpublish(frontierDispatcher.get());
+}
+
+void RecursiveJoin::helpComputeBFS(ExecutionContext* context) {
+    if (!frontierDispatcher) {
+        return;
+    }
+    while (auto dispatcher = sharedState->frontiers.acquire()) {
+        try {
+            vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0,
+                dispatcher->extendsFirstLevel());
+            extendFrontierMorsels(context, *dispatcher);
+        } catch (...) {
+            sharedState->frontiers.release(dispatcher);
+            throw;
+        }
+        sharedState->frontiers.release(dispatcher);
+    }
+}
+
+void RecursiveJoin::extendFrontierMorsels(ExecutionContext* context,
+    FrontierMorselDispatcher& dispatcher) {
+    auto& state = *dispatcher.getBFSState();
+    auto& nodeIDs = state.getCurrentFrontier()->nodeIDs;
+    uint64_t startIdx = 0, endIdx = 0;
+    while (dispatcher.getMorsel(startIdx, endIdx)) {
+        for (auto i = startIdx; i < endIdx; i++) {
+            extend(context, state, nodeIDs[i], true /* concurrently */);
         }
     }
 }
 
-void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
-    auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
+void RecursiveJoin::extend(ExecutionContext* context, BaseBFSState& state, nodeID_t boundNodeID,
+    bool concurrently) {
+    recursiveSource->init(boundNodeID);
+    while (recursiveRoot->getNextTuple(context)) { // Exhaust recursive plan.
+        updateVisitedNodes(state, boundNodeID, concurrently);
+    }
+}
+
+void RecursiveJoin::updateVisitedNodes(BaseBFSState& state, nodeID_t boundNodeID,
+    bool concurrently) {
+    auto boundNodeMultiplicity = state.getMultiplicity(boundNodeID);
     auto& selVector = vectors->recursiveDstNodeIDVector->state->getSelVector();
     for (auto i = 0u; i < selVector.getSelSize(); ++i) {
         auto pos = selVector[i];
@@ -243,10 +343,60 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
                 RelIDMasker::markFlip(edgeID);
             }
         }
-        bfsState->markVisited(boundNodeID, nbrNodeID, edgeID, boundNodeMultiplicity);
+        if (concurrently) {
+            state.markVisitedConcurrently(boundNodeID, nbrNodeID, edgeID, boundNodeMultiplicity);
+        } else {
+            state.markVisited(boundNodeID, nbrNodeID, edgeID, boundNodeMultiplicity);
+        }
     }
 }
 
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context, nodeID_t srcNodeID,
+    nodeID_t dstNodeID) {
+    bidirectionalBFSState->resetState(srcNodeID, dstNodeID);
+    while (!bidirectionalBFSState->isComplete()) {
+        extendBidirectional(context, bidirectionalBFSState->shouldExtendFromSrc());
+    }
+    bidirectionalBFSState->writePath(*bfsState, info.joinType == RecursiveJoinType::TRACK_PATH);
+}
+
+void RecursiveJoin::extendBidirectional(ExecutionContext* context, bool fromSrc) {
+    auto& side = bidirectionalBFSState->getSide(fromSrc);
+    auto root = fromSrc ? recursiveRoot.get() : reverseRecursiveRoot.get();
+    auto source = fromSrc ? recursiveSource : reverseRecursiveSource;
+    auto& sideVectors = fromSrc ? *vectors : *reverseVectors;
+    for (auto boundNodeID : side.getCurrentFrontier()) {
+        source->init(boundNodeID);
+        auto pathFound = false;
+        while (root->getNextTuple(context)) {
+            // Exhaust the recursive plan even if a path is found so it can be reused.
+            if (pathFound) {
+                continue;
+            }
+            auto& selVector = sideVectors.recursiveDstNodeIDVector->state->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+                auto pos = selVector[i];
+                auto nbrNodeID = sideVectors.recursiveDstNodeIDVector->getValue<nodeID_t>(pos);
+                auto edgeID = sideVectors.recursiveEdgeIDVector->getValue<relID_t>(pos);
+                // The reverse plan extends from the other end of the pattern, so its flip marks
+                // are relative to the same orientation as the ones of the forward plan.
+                if (sideVectors.recursiveEdgeDirectionVector != nullptr &&
+                    sideVectors.recursiveEdgeDirectionVector->getValue<bool>(pos)) {
+                    RelIDMasker::markFlip(edgeID);
+                }
+                if (bidirectionalBFSState->markVisited(fromSrc, boundNodeID, nbrNodeID, edgeID)) {
+                    pathFound = true;
+                    break;
+                }
+            }
+        }
+        if (pathFound) {
+            return;
+        }
+    }
+    side.finalizeCurrentLevel();
+}
+
 static PhysicalOperator* getSource(PhysicalOperator* op) {
     while (op->getNumChildren() != 0) {
         KU_ASSERT(op->getNumChildren() == 1);
@@ -273,17 +423,37 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     recursiveSource = getSource(recursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
 }
 
+void RecursiveJoin::initLocalReverseRecursivePlan(ExecutionContext* context) {
+    // The reverse recursive plan has the same schema as the forward one.
+    auto& dataInfo = info.dataInfo;
+    reverseLocalResultSet = std::make_unique<ResultSet>(dataInfo.localResultSetDescriptor.get(),
+        context->clientContext->getMemoryManager());
+    reverseVectors = std::make_unique<RecursiveJoinVectors>();
+    reverseVectors->recursiveDstNodeIDVector =
+        reverseLocalResultSet->getValueVector(dataInfo.recursiveDstNodeIDPos).get();
+    reverseVectors->recursiveNodePredicateExecFlagVector =
+        reverseLocalResultSet->getValueVector(dataInfo.recursiveNodePredicateExecFlagPos).get();
+    reverseVectors->recursiveEdgeIDVector =
+        reverseLocalResultSet->getValueVector(dataInfo.recursiveEdgeIDPos).get();
+    if (dataInfo.recursiveEdgeDirectionPos.isValid()) {
+        reverseVectors->recursiveEdgeDirectionVector =
+            reverseLocalResultSet->getValueVector(dataInfo.recursiveEdgeDirectionPos).get();
+    }
+    reverseRecursiveRoot->initLocalState(reverseLocalResultSet.get(), context);
+    reverseRecursiveSource =
+        getSource(reverseRecursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
+}
+
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext*) {
     node_id_set_t targetNodeIDs;
     uint64_t numTargetNodes = 0;
     for (auto& mask : sharedState->semiMasks) {
         auto numNodes = mask->getMaxOffset() + 1;
         if (mask->isEnabled()) {
-            for (auto offset = 0u; offset < numNodes; ++offset) {
-                if (mask->isMasked(offset)) {
-                    targetNodeIDs.insert(nodeID_t{offset, mask->getTableID()});
-                    numTargetNodes++;
-                }
+            for (auto offset = mask->getNextMaskedOffset(0); offset < numNodes;
+                 offset = mask->getNextMaskedOffset(offset + 1)) {
+                targetNodeIDs.insert(nodeID_t{offset, mask->getTableID()});
+                numTargetNodes++;
             }
         } else {
             KU_ASSERT(targetNodeIDs.empty());
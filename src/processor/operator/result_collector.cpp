@@ -37,19 +37,39 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    const auto chunkQueue = sharedState->getChunkQueue();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            // Streamed results are handed over one data block of tuples at a time.
+            if (chunkQueue && localTable->getNumTuples() >= localTable->getNumTuplesPerBlock()) {
+                pushLocalTableToChunkQueue(context);
+            }
         }
     }
-    if (!payloadVectors.empty()) {
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (chunkQueue) {
+        if (!localTable->isEmpty()) {
+            pushLocalTableToChunkQueue(context);
+        }
+    } else {
         metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
         sharedState->mergeLocalTable(*localTable);
     }
 }
 
+void ResultCollector::pushLocalTableToChunkQueue(ExecutionContext* context) {
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    auto chunk = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+        info.tableSchema.copy());
+    std::swap(chunk, localTable);
+    sharedState->getChunkQueue()->push(std::move(chunk), context->clientContext);
+}
+
 void ResultCollector::finalizeInternal(ExecutionContext* /*context*/) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -0,0 +1,59 @@
+#include "processor/operator/scan/count_rel_table.h"
+
+#include "storage/local_storage/local_rel_table.h"
+#include "storage/local_storage/local_storage.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void CountRelTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    nodeIDVector = resultSet->getValueVector(nodeIDPos).get();
+    countVector = resultSet->getValueVector(countPos).get();
+    // Only the CSR header is read, so the nbr id column is listed to set up the scan state.
+    const auto columnIDs = std::vector<column_id_t>{NBR_ID_COLUMN_ID};
+    const auto columns = std::vector<Column*>{table->getColumn(NBR_ID_COLUMN_ID, direction)};
+    scanState = std::make_unique<RelTableScanState>(*context->clientContext->getMemoryManager(),
+        table->getTableID(), columnIDs, columns, table->getCSROffsetColumn(direction),
+        table->getCSRLengthColumn(direction), direction);
+    if (const auto localRelTable =
+            context->clientContext->getTx()->getLocalStorage()->getLocalTable(table->getTableID(),
+                LocalStorage::NotExistAction::RETURN_NULL)) {
+        auto localTableColumnIDs =
+            LocalRelTable::rewriteLocalColumnIDs(direction, scanState->columnIDs);
+        scanState->localTableScanState = std::make_unique<LocalRelTableScanState>(*scanState,
+            localTableColumnIDs, localRelTable->ptrCast<LocalRelTable>());
+    }
+}
+
+bool CountRelTable::getNextTuplesInternal(ExecutionContext* context) {
+    const auto transaction = context->clientContext->getTx();
+    sel_t numSelectedValues = 0;
+    do {
+        restoreSelVector(*nodeIDVector->state);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        saveSelVector(*nodeIDVector->state);
+        auto& selVector = nodeIDVector->state->getSelVectorUnsafe();
+        numSelectedValues = 0;
+        auto buffer = selVector.getMutableBuffer();
+        for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+            const auto pos = selVector[i];
+            const auto numRels = table->countRels(transaction, *scanState,
+                nodeIDVector->getValue<nodeID_t>(pos).offset);
+            countVector->setValue<int64_t>(pos, numRels);
+            buffer[numSelectedValues] = pos;
+            numSelectedValues += numRels > 0;
+        }
+        selVector.setToFiltered();
+    } while (numSelectedValues == 0);
+    nodeIDVector->state->getSelVectorUnsafe().setSelSize(numSelectedValues);
+    metrics->numOutputTuple.increase(numSelectedValues);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,112 @@
+#include "processor/operator/scan/fetch_node_property.h"
+
+#include <algorithm>
+
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void FetchNodeProperty::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
+    nodeIDVector = resultSet->getValueVector(info.nodeIDPos).get();
+    nodeInfo.initScanState(nullptr);
+    initVectors(*nodeInfo.localScanState, *resultSet);
+}
+
+void FetchNodeProperty::initVectors(TableScanState& state, const ResultSet& resultSet) const {
+    ScanTable::initVectors(state, resultSet);
+    state.rowIdxVector->state = state.nodeIDVector->state;
+    state.outState = state.rowIdxVector->state.get();
+}
+
+bool FetchNodeProperty::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    auto& selVector = nodeIDVector->state->getSelVectorUnsafe();
+    const auto numSelected = selVector.getSelSize();
+    const auto isUnfiltered = selVector.isUnfiltered();
+    selectedPositions.assign(selVector.getSelectedPositions().begin(),
+        selVector.getSelectedPositions().end());
+    positionsToLookup.clear();
+    for (auto pos : selectedPositions) {
+        if (nodeIDVector->isNull(pos)) {
+            for (auto& vector : nodeInfo.localScanState->outputVectors) {
+                vector->setNull(pos, true);
+            }
+        } else {
+            positionsToLookup.push_back(pos);
+        }
+    }
+    // Node IDs from a scan are already sorted. Otherwise, sort them so that nodes in the same node
+    // group are adjacent.
+    auto offsetLess = [&](sel_t a, sel_t b) {
+        return nodeIDVector->readNodeOffset(a) < nodeIDVector->readNodeOffset(b);
+    };
+    if (!std::is_sorted(positionsToLookup.begin(), positionsToLookup.end(), offsetLess)) {
+        std::sort(positionsToLookup.begin(), positionsToLookup.end(), offsetLess);
+    }
+    const auto transaction = context->clientContext->getTx();
+    // Uncommitted offsets start at a multiple of the node group size, so the node group of the raw
+    // offset identifies both the source and the node group.
+    auto getGroupIdx = [&](sel_t pos) {
+        return StorageUtils::getNodeGroupIdx(nodeIDVector->readNodeOffset(pos));
+    };
+    auto selVectorChanged = false;
+    auto start = 0u;
+    while (start < positionsToLookup.size()) {
+        const auto groupIdx = getGroupIdx(positionsToLookup[start]);
+        auto end = start + 1;
+        while (end < positionsToLookup.size() && getGroupIdx(positionsToLookup[end]) == groupIdx) {
+            end++;
+        }
+        if (end - start < numSelected) {
+            // Restrict the selection to the nodes in this node group.
+            selVector.setToFiltered(end - start);
+            std::copy(positionsToLookup.begin() + start, positionsToLookup.begin() + end,
+                selVector.getMutableBuffer().begin());
+            selVectorChanged = true;
+        }
+        lookup(transaction, nodeIDVector->readNodeOffset(positionsToLookup[start]));
+        start = end;
+    }
+    if (selVectorChanged) {
+        if (isUnfiltered) {
+            selVector.setToUnfiltered(numSelected);
+        } else {
+            std::copy(selectedPositions.begin(), selectedPositions.end(),
+                selVector.getMutableBuffer().begin());
+            selVector.setToFiltered(numSelected);
+        }
+    }
+    metrics->numOutputTuple.increase(numSelected);
+    return true;
+}
+
+void FetchNodeProperty::lookup(transaction::Transaction* transaction, offset_t offset) {
+    auto& scanState = *nodeInfo.localScanState;
+    if (offset >= StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
+        scanState.source = TableScanSource::UNCOMMITTED;
+        scanState.nodeGroupIdx =
+            StorageUtils::getNodeGroupIdx(offset - StorageConstants::MAX_NUM_ROWS_IN_TABLE);
+    } else {
+        scanState.source = TableScanSource::COMMITTED;
+        scanState.nodeGroupIdx = StorageUtils::getNodeGroupIdx(offset);
+    }
+    nodeInfo.table->initScanState(transaction, scanState);
+    // The node IDs come from operators of the same query, so they are normally visible. A node
+    // deleted earlier in the query is not, and lookupMultiple leaves its outputs untouched, so its
+    // properties are set to null up front.
+    scanState.nodeIDVector->state->getSelVector().forEach([&](auto pos) {
+        for (auto& vector : scanState.outputVectors) {
+            vector->setNull(pos, true);
+        }
+    });
+    nodeInfo.table->lookupMultiple(transaction, scanState);
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -3,6 +3,7 @@
 #include "binder/expression/expression_util.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_storage.h"
+#include "storage/storage_utils.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -44,6 +45,17 @@ void ScanNodeTableSharedState::initialize(const transaction::Transaction* transa
 void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState,
     ScanNodeTableProgressSharedState& progressSharedState) {
     std::unique_lock lck{mtx};
+    if (currentCommittedGroupIdx < numCommittedNodeGroups && semiMask && semiMask->isEnabled()) {
+        // Skip node groups without any masked offset.
+        const auto nextMaskedOffset = semiMask->getNextMaskedOffset(
+            StorageUtils::getStartOffsetOfNodeGroup(currentCommittedGroupIdx));
+        const auto nextGroupIdx = nextMaskedOffset == INVALID_OFFSET ?
+                                      numCommittedNodeGroups :
+                                      std::min(StorageUtils::getNodeGroupIdx(nextMaskedOffset),
+                                          numCommittedNodeGroups);
+        progressSharedState.numGroupsScanned += nextGroupIdx - currentCommittedGroupIdx;
+        currentCommittedGroupIdx = nextGroupIdx;
+    }
     if (currentCommittedGroupIdx < numCommittedNodeGroups) {
         scanState.nodeGroupIdx = currentCommittedGroupIdx++;
         progressSharedState.numGroupsScanned++;
@@ -30,19 +30,32 @@ void BaseSemiMasker::initGlobalStateInternal(ExecutionContext* /*context*/) {
 
 void BaseSemiMasker::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
     keyVector = resultSet->getValueVector(info->keyPos).get();
+    for (auto& [tableID, _] : info->masksPerTable) {
+        localMasks[tableID] = RoaringBitmap{};
+    }
+}
+
+void BaseSemiMasker::mergeLocalMasks() {
+    for (auto& [tableID, masks] : info->masksPerTable) {
+        auto& localMask = localMasks.at(tableID);
+        for (auto& [mask, maskerIdx] : masks) {
+            mask->mergeMask(maskerIdx, localMask);
+        }
+        localMask = RoaringBitmap{};
+    }
 }
 
 bool SingleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
+        mergeLocalMasks();
         return false;
     }
     auto& selVector = keyVector->state->getSelVector();
+    auto& localMask = getSingleTableLocalMask();
     for (auto i = 0u; i < selVector.getSelSize(); i++) {
         auto pos = selVector[i];
         auto nodeID = keyVector->getValue<nodeID_t>(pos);
-        for (auto& [mask, maskerIdx] : info->getSingleTableMasks()) {
-            mask->incrementMaskValue(nodeID.offset, maskerIdx);
-        }
+        localMask.add(nodeID.offset);
     }
     metrics->numOutputTuple.increase(selVector.getSelSize());
     return true;
@@ -50,15 +63,14 @@ bool SingleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
 
 bool MultiTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
+        mergeLocalMasks();
         return false;
     }
     auto& selVector = keyVector->state->getSelVector();
     for (auto i = 0u; i < selVector.getSelSize(); i++) {
         auto pos = selVector[i];
         auto nodeID = keyVector->getValue<nodeID_t>(pos);
-        for (auto& [mask, maskerIdx] : info->getTableMasks(nodeID.tableID)) {
-            mask->incrementMaskValue(nodeID.offset, maskerIdx);
-        }
+        getTableLocalMask(nodeID.tableID).add(nodeID.offset);
     }
     metrics->numOutputTuple.increase(selVector.getSelSize());
     return true;
@@ -81,18 +93,16 @@ void PathSemiMasker::initLocalStateInternal(ResultSet* resultSet, ExecutionConte
 
 bool PathSingleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
+        mergeLocalMasks();
         return false;
     }
     auto size = ListVector::getDataVectorSize(pathRelsVector);
+    auto& localMask = getSingleTableLocalMask();
     for (auto i = 0u; i < size; ++i) {
         auto srcNodeID = pathRelsSrcIDDataVector->getValue<nodeID_t>(i);
-        for (auto& [mask, maskerIdx] : info->getSingleTableMasks()) {
-            mask->incrementMaskValue(srcNodeID.offset, maskerIdx);
-        }
+        localMask.add(srcNodeID.offset);
         auto dstNodeID = pathRelsDstIDDataVector->getValue<nodeID_t>(i);
-        for (auto& [mask, maskerIdx] : info->getSingleTableMasks()) {
-            mask->incrementMaskValue(dstNodeID.offset, maskerIdx);
-        }
+        localMask.add(dstNodeID.offset);
     }
     metrics->numOutputTuple.increase(size);
     return true;
@@ -100,18 +110,15 @@ bool PathSingleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context)
 
 bool PathMultipleTableSemiMasker::getNextTuplesInternal(ExecutionContext* context) {
     if (!children[0]->getNextTuple(context)) {
+        mergeLocalMasks();
         return false;
     }
     auto size = ListVector::getDataVectorSize(pathRelsVector);
     for (auto i = 0u; i < size; ++i) {
         auto srcNodeID = pathRelsSrcIDDataVector->getValue<nodeID_t>(i);
-        for (auto& [mask, maskerIdx] : info->getTableMasks(srcNodeID.tableID)) {
-            mask->incrementMaskValue(srcNodeID.offset, maskerIdx);
-        }
+        getTableLocalMask(srcNodeID.tableID).add(srcNodeID.offset);
         auto dstNodeID = pathRelsDstIDDataVector->getValue<nodeID_t>(i);
-        for (auto& [mask, maskerIdx] : info->getTableMasks(dstNodeID.tableID)) {
-            mask->incrementMaskValue(dstNodeID.offset, maskerIdx);
-        }
+        getTableLocalMask(dstNodeID.tableID).add(dstNodeID.offset);
     }
     metrics->numOutputTuple.increase(size);
     return true;
@@ -7,6 +7,7 @@
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
+#include "common/constants.h"
 #include "common/copier_config/csv_reader_config.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/string_utils.h"
@@ -56,8 +57,16 @@ static void writeCopyStatement(stringstream& ss, const TableCatalogEntry* entry,
     const ReaderConfig* boundFileInfo) {
     auto fileTypeStr = boundFileInfo->fileTypeInfo.fileTypeStr;
     StringUtils::toLower(fileTypeStr);
-    const auto csvConfig = CSVReaderConfig::construct(boundFileInfo->options);
+    auto options = boundFileInfo->options;
+    auto perThreadOutput = false;
+    if (options.contains(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION)) {
+        perThreadOutput = options.at(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION).getValue<bool>();
+        options.erase(ExportCSVConstants::PER_THREAD_OUTPUT_OPTION);
+    }
+    const auto csvConfig = CSVReaderConfig::construct(options);
     const auto tableName = entry->getName();
+    // With per thread output, every thread exports the table to its own file.
+    const auto fileName = perThreadOutput ? tableName + "_*" : tableName;
     std::string columns;
     const auto numProperties = entry->getNumProperties();
     for (auto i = 0u; i < numProperties; i++) {
@@ -65,7 +74,7 @@ static void writeCopyStatement(stringstream& ss, const TableCatalogEntry* entry,
         columns += prop.getName();
         columns += i == numProperties - 1 ? "" : ",";
     }
-    ss << stringFormat("COPY {} ( {} ) FROM \"{}.{}\" {};\n", tableName, columns, tableName,
+    ss << stringFormat("COPY {} ( {} ) FROM \"{}.{}\" {};\n", tableName, columns, fileName,
         fileTypeStr, csvConfig.option.toCypher());
 }
 
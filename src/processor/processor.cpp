@@ -25,8 +25,13 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
+    // The root pipeline of a streamed result keeps its worker threads, and only its result
+    // collectors block when the consumer falls behind. A dedicated thread is added so that the
+    // stream makes progress even while all shared worker threads are busy.
+    const auto isStreaming = resultCollector->isStreamingResult();
     context->clientContext->getProgressBar()->startProgress(context->queryID);
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    taskScheduler->scheduleTaskAndWaitOrError(task, context,
+        isStreaming /* launchNewWorkerThread */);
     context->clientContext->getProgressBar()->endProgress(context->queryID);
     return resultCollector->getResultFactorizedTable();
 }
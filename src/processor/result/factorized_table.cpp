@@ -589,6 +589,25 @@ void FlatTupleIterator::getNextFlatTuple() {
     nextFlatTupleIdx++;
 }
 
+uint64_t FlatTupleIterator::scanNextFlatTuples(std::vector<ValueVector*>& vectors,
+    uint64_t maxNumTuples) {
+    KU_ASSERT(!factorizedTable.hasUnflatCol());
+    // The current tuple has not been read yet if its flat tuple has not been iterated.
+    auto startTupleIdx = nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+    const auto numTuples = factorizedTable.getNumTuples();
+    if (startTupleIdx >= numTuples || maxNumTuples == 0) {
+        return 0;
+    }
+    auto numTuplesToScan = std::min(maxNumTuples, numTuples - startTupleIdx);
+    factorizedTable.scan(vectors, startTupleIdx, numTuplesToScan);
+    // Leave the iterator as if getNextFlatTuple had just returned the last scanned tuple.
+    nextTupleIdx = startTupleIdx + numTuplesToScan;
+    currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx - 1);
+    numFlatTuples = 1;
+    nextFlatTupleIdx = 1;
+    return numTuplesToScan;
+}
+
 void FlatTupleIterator::resetState() {
     numFlatTuples = 0;
     nextFlatTupleIdx = 0;
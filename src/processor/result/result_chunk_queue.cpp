@@ -0,0 +1,80 @@
+#include "processor/result/result_chunk_queue.h"
+
+#include <chrono>
+
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+// Interrupts are raised by setting a flag on the client context without notifying the queue, so
+// blocked producers poll the flag.
+static constexpr auto INTERRUPT_POLL_INTERVAL = std::chrono::milliseconds(10);
+
+void ResultChunkQueue::push(std::unique_ptr<FactorizedTable> chunk,
+    main::ClientContext* clientContext) {
+    std::unique_lock lck{mtx};
+    while (chunks.size() >= capacity && !closed) {
+        if (clientContext->interrupted()) {
+            throw InterruptException{};
+        }
+        cv.wait_for(lck, INTERRUPT_POLL_INTERVAL);
+    }
+    if (closed) {
+        throw InterruptException{};
+    }
+    chunks.push_back(std::move(chunk));
+    lck.unlock();
+    cv.notify_all();
+}
+
+void ResultChunkQueue::finishProducing(std::exception_ptr error_) {
+    std::unique_lock lck{mtx};
+    producingFinished = true;
+    error = std::move(error_);
+    lck.unlock();
+    cv.notify_all();
+}
+
+std::unique_ptr<FactorizedTable> ResultChunkQueue::pop() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return !chunks.empty() || producingFinished || closed; });
+    if (closed) {
+        return nullptr;
+    }
+    if (chunks.empty()) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return nullptr;
+    }
+    auto chunk = std::move(chunks.front());
+    chunks.pop_front();
+    lck.unlock();
+    cv.notify_all();
+    return chunk;
+}
+
+void ResultChunkQueue::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    chunks.clear();
+    lck.unlock();
+    cv.notify_all();
+}
+
+bool ResultChunkQueue::isExhausted() const {
+    std::unique_lock lck{mtx};
+    return producingFinished && chunks.empty();
+}
+
+bool ResultChunkQueue::hasError() const {
+    std::unique_lock lck{mtx};
+    return error != nullptr;
+}
+
+} // namespace processor
+} // namespace kuzu
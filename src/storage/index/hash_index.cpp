@@ -1,13 +1,18 @@
 #include "storage/index/hash_index.h"
 
+#include <atomic>
 #include <bitset>
 #include <cstdint>
 
 #include "common/assert.h"
 #include "common/constants.h"
+#include "common/task_system/task_scheduler.h"
 #include "common/types/int128_t.h"
 #include "common/types/ku_string.h"
 #include "common/types/types.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
+#include "processor/execution_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/file_handle.h"
 #include "storage/index/hash_index_header.h"
@@ -499,6 +504,51 @@ bool PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector, uin
     return retVal;
 }
 
+void PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results, visible_func isVisible) {
+    KU_ASSERT(positions.size() == results.size());
+    struct KeyToLookup {
+        uint64_t indexPos;
+        slot_id_t slotId;
+        hash_t hash;
+        idx_t idx;
+    };
+    TypeUtils::visit(
+        keyDataTypeID,
+        [&]<IndexHashable T>(T) {
+            auto getKey = [&](sel_t pos) {
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    return keyVector->getValue<ku_string_t>(pos).getAsStringView();
+                } else {
+                    return keyVector->getValue<T>(pos);
+                }
+            };
+            std::vector<KeyToLookup> keysToLookup;
+            keysToLookup.reserve(positions.size());
+            for (auto i = 0u; i < positions.size(); i++) {
+                if (results[i] != INVALID_OFFSET) {
+                    continue;
+                }
+                const auto hash = HashIndexUtils::hash(getKey(positions[i]));
+                const auto indexPos = HashIndexUtils::getHashIndexPositionForHash(hash);
+                const auto slotId = getTypedHashIndexByPos<HashIndexType<T>>(indexPos)
+                                        ->getPrimarySlotIdForHash(trx, hash);
+                keysToLookup.push_back(KeyToLookup{indexPos, slotId, hash, i});
+            }
+            std::sort(keysToLookup.begin(), keysToLookup.end(), [](const auto& a, const auto& b) {
+                return a.indexPos < b.indexPos || (a.indexPos == b.indexPos && a.slotId < b.slotId);
+            });
+            for (auto& keyToLookup : keysToLookup) {
+                auto* hashIndex = getTypedHashIndexByPos<HashIndexType<T>>(keyToLookup.indexPos);
+                if (!hashIndex->lookupInternal(trx, getKey(positions[keyToLookup.idx]),
+                        keyToLookup.hash, results[keyToLookup.idx], isVisible)) {
+                    results[keyToLookup.idx] = INVALID_OFFSET;
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 bool PrimaryKeyIndex::insert(const Transaction* transaction, ValueVector* keyVector,
     uint64_t vectorPos, offset_t value, visible_func isVisible) {
     bool result = false;
@@ -562,13 +612,50 @@ void PrimaryKeyIndex::writeHeaders() {
     KU_ASSERT(headerIdx == NUM_HASH_INDEXES);
 }
 
-void PrimaryKeyIndex::checkpoint() {
-    bool indexChanged = false;
-    for (auto i = 0u; i < NUM_HASH_INDEXES; i++) {
-        if (hashIndices[i]->checkpoint()) {
-            indexChanged = true;
+// Checkpoints the hash indexes of a primary key index. Each hash index owns its slot disk arrays
+// and overflow file handle, so indexes with local insertions to merge (e.g. after a COPY) are
+// checkpointed in parallel. Workers claim index positions from a shared counter, as the number of
+// insertions per index may be uneven.
+class HashIndexCheckpointTask final : public Task {
+public:
+    HashIndexCheckpointTask(uint64_t maxNumThreads,
+        std::vector<std::unique_ptr<OnDiskHashIndex>>& hashIndices)
+        : Task{maxNumThreads}, hashIndices{hashIndices} {}
+
+    void run() override {
+        for (auto indexPos = nextIndexPos.fetch_add(1); indexPos < hashIndices.size();
+             indexPos = nextIndexPos.fetch_add(1)) {
+            if (hashIndices[indexPos]->checkpoint()) {
+                indexChanged.store(true, std::memory_order_relaxed);
+            }
         }
     }
+
+    bool hasIndexChanged() const { return indexChanged.load(); }
+
+private:
+    std::vector<std::unique_ptr<OnDiskHashIndex>>& hashIndices;
+    std::atomic<uint64_t> nextIndexPos = 0;
+    std::atomic<bool> indexChanged = false;
+};
+
+void PrimaryKeyIndex::checkpoint(main::ClientContext* context) {
+    const auto numIndexesWithUpdates = std::count_if(hashIndices.begin(), hashIndices.end(),
+        [](const auto& hashIndex) { return hashIndex->hasUpdates(); });
+    const auto numThreads = std::min(context->getDBConfig()->maxNumThreads,
+        static_cast<uint64_t>(std::max<int64_t>(numIndexesWithUpdates, 1)));
+    auto task = std::make_shared<HashIndexCheckpointTask>(numThreads, hashIndices);
+    if (numThreads > 1) {
+        // Checkpoints can be run by a worker thread of the task scheduler (e.g. CHECKPOINT), so a
+        // new worker thread is launched to make sure the task makes progress.
+        processor::ExecutionContext executionContext{nullptr /* profiler */, context,
+            0 /* queryID */};
+        context->getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
+    } else {
+        task->run();
+    }
+    const auto indexChanged = task->hasIndexChanged();
     if (indexChanged) {
         writeHeaders();
         hashIndexDiskArrays->checkpoint();
@@ -86,22 +86,19 @@ bool DiskArrayInternal::checkOutOfBoundAccess(TransactionType trxType, uint64_t
 
 void DiskArrayInternal::get(uint64_t idx, const Transaction* transaction,
     std::span<std::byte> val) {
-    std::shared_lock sLck{diskArraySharedMtx};
+    readInPlace(idx, transaction,
+        [&val](const uint8_t* element) -> void { memcpy(val.data(), element, val.size()); });
+}
+
+DiskArrayInternal::ElementLocation DiskArrayInternal::locateElementNoLock(uint64_t idx,
+    const Transaction* transaction) {
     KU_ASSERT(checkOutOfBoundAccess(transaction->getType(), idx));
     auto apCursor = getAPIdxAndOffsetInAP(storageInfo, idx);
     page_idx_t apPageIdx = getAPPageIdxNoLock(apCursor.pageIdx, transaction->getType());
-    if (transaction->getType() != TransactionType::CHECKPOINT || !hasTransactionalUpdates ||
-        apPageIdx > lastPageOnDisk ||
-        !shadowFile->hasShadowPage(fileHandle.getFileIndex(), apPageIdx)) {
-        fileHandle.optimisticReadPage(apPageIdx, [&](const uint8_t* frame) -> void {
-            memcpy(val.data(), frame + apCursor.elemPosInPage, val.size());
-        });
-    } else {
-        ShadowUtils::readShadowVersionOfPage(fileHandle, apPageIdx, *shadowFile,
-            [&val, &apCursor](const uint8_t* frame) -> void {
-                memcpy(val.data(), frame + apCursor.elemPosInPage, val.size());
-            });
-    }
+    auto readShadowPage = transaction->getType() == TransactionType::CHECKPOINT &&
+                          hasTransactionalUpdates && apPageIdx <= lastPageOnDisk &&
+                          shadowFile->hasShadowPage(fileHandle.getFileIndex(), apPageIdx);
+    return ElementLocation{apPageIdx, apCursor.elemPosInPage, readShadowPage};
 }
 
 void DiskArrayInternal::updatePage(uint64_t pageIdx, bool isNewPage,
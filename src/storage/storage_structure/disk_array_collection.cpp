@@ -41,6 +41,7 @@ DiskArrayCollection::DiskArrayCollection(FileHandle& fileHandle, DBFileID dbFile
 }
 
 void DiskArrayCollection::checkpoint() {
+    std::unique_lock lck{mtx};
     // Write headers to disk
     size_t indexInMemory = 0;
     auto headerPageIdx = headerPageIndices.begin();
@@ -66,6 +67,7 @@ void DiskArrayCollection::checkpoint() {
 }
 
 size_t DiskArrayCollection::addDiskArray() {
+    std::unique_lock lck{mtx};
     auto oldSize = numHeaders++;
     if (headersForReadTrx.empty() ||
         headersForWriteTrx.back()->numHeaders == HeaderPage::NUM_HEADERS_PER_PAGE) {
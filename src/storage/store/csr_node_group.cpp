@@ -1,5 +1,7 @@
 #include "storage/store/csr_node_group.h"
 
+#include <algorithm>
+
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/store/rel_table.h"
@@ -102,6 +104,42 @@ void CSRNodeGroup::initScanForCommittedPersistent(Transaction* transaction,
     nodeGroupScanState.numTotalRows = nodeGroupScanState.header->getStartCSROffset(numBoundNodes);
 }
 
+row_idx_t CSRNodeGroup::countRels(Transaction* transaction, RelTableScanState& relScanState,
+    offset_t boundOffsetInGroup) {
+    auto& nodeGroupScanState = relScanState.nodeGroupScanState->cast<CSRNodeGroupScanState>();
+    if (relScanState.nodeGroupIdx != nodeGroupIdx) {
+        nodeGroupScanState.resetState();
+        relScanState.nodeGroupIdx = nodeGroupIdx;
+        relScanState.nodeGroup = this;
+        if (persistentChunkGroup) {
+            initScanForCommittedPersistent(transaction, relScanState, nodeGroupScanState);
+        }
+    }
+    row_idx_t numRels = 0;
+    if (persistentChunkGroup) {
+        const auto& header = *nodeGroupScanState.header;
+        const auto length = header.getCSRLength(boundOffsetInGroup);
+        numRels += length - persistentChunkGroup->getNumDeletions(transaction,
+                                header.getStartCSROffset(boundOffsetInGroup), length);
+    }
+    if (csrIndex && !csrIndex->indices[boundOffsetInGroup].isEmpty()) {
+        const auto lock = chunkedGroups.lock();
+        for (const auto row : csrIndex->indices[boundOffsetInGroup].getRows()) {
+            if (row == INVALID_ROW_IDX) {
+                continue;
+            }
+            auto [chunkIdx, rowInChunk] =
+                StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+            const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
+            if (chunkedGroup->isInserted(transaction, rowInChunk) &&
+                !chunkedGroup->isDeleted(transaction, rowInChunk)) {
+                numRels++;
+            }
+        }
+    }
+    return numRels;
+}
+
 void CSRNodeGroup::initScanForCommittedInMem(RelTableScanState& relScanState,
     CSRNodeGroupScanState& nodeGroupScanState) const {
     relScanState.currBoundNodeIdx = 0;
@@ -432,6 +470,85 @@ void CSRNodeGroup::serialize(Serializer& serializer) {
         serializer.writeDebuggingInfo("checkpointed_data");
         persistentChunkGroup->serialize(serializer);
     }
+    serializer.writeDebuggingInfo("delta_runs");
+    serializer.serializeVectorOfPtrs(deltaRuns);
+    if (!deltaRuns.empty()) {
+        KU_ASSERT(csrIndex);
+        serializer.writeDebuggingInfo("delta_csr_index");
+        uint64_t numNodes = 0;
+        for (auto& index : csrIndex->indices) {
+            numNodes += !index.isEmpty();
+        }
+        serializer.write<uint64_t>(numNodes);
+        for (auto offset = 0u; offset < csrIndex->indices.size(); offset++) {
+            auto& index = csrIndex->indices[offset];
+            if (index.isEmpty()) {
+                continue;
+            }
+            serializer.write<offset_t>(offset);
+            serializer.write<bool>(index.isSequential);
+            serializer.serializeVector(index.rowIndices);
+        }
+    }
+}
+
+void CSRNodeGroup::deserializeDeltaRuns(MemoryManager& memoryManager, Deserializer& deSer) {
+    std::string key;
+    deSer.validateDebuggingInfo(key, "delta_runs");
+    deSer.deserializeVectorOfPtrs<ChunkedNodeGroup>(deltaRuns,
+        [&](Deserializer& deser) { return ChunkedNodeGroup::deserialize(memoryManager, deser); });
+    if (deltaRuns.empty()) {
+        return;
+    }
+    deSer.validateDebuggingInfo(key, "delta_csr_index");
+    csrIndex = std::make_unique<CSRIndex>();
+    uint64_t numNodes = 0;
+    deSer.deserializeValue<uint64_t>(numNodes);
+    for (auto i = 0u; i < numNodes; i++) {
+        offset_t offset = INVALID_OFFSET;
+        deSer.deserializeValue<offset_t>(offset);
+        auto& index = csrIndex->indices[offset];
+        deSer.deserializeValue<bool>(index.isSequential);
+        deSer.deserializeVector(index.rowIndices);
+    }
+}
+
+void CSRNodeGroup::loadDeltaRuns(MemoryManager& memoryManager,
+    const std::vector<std::unique_ptr<Column>>& columns) {
+    const auto lock = chunkedGroups.lock();
+    KU_ASSERT(chunkedGroups.isEmpty(lock) && numRows == 0);
+    for (auto& run : deltaRuns) {
+        KU_ASSERT(run->getNumColumns() == dataTypes.size());
+        std::vector<std::unique_ptr<ColumnChunk>> runChunks;
+        std::vector<ColumnChunk*> chunksToAppend;
+        for (auto i = 0u; i < run->getNumColumns(); i++) {
+            runChunks.push_back(std::make_unique<ColumnChunk>(memoryManager, dataTypes[i].copy(),
+                run->getNumRows(), enableCompression, ResidencyState::IN_MEMORY));
+            ChunkState chunkState;
+            run->getColumnChunk(i).initializeScanState(chunkState, columns[i].get());
+            run->getColumnChunk(i).scanCommitted<ResidencyState::ON_DISK>(
+                &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *runChunks.back(), 0,
+                run->getNumRows());
+            chunksToAppend.push_back(runChunks.back().get());
+        }
+        // Rows are appended without version info, so they are visible to all transactions.
+        row_idx_t numRowsAppended = 0;
+        while (numRowsAppended < run->getNumRows()) {
+            auto lastChunkedGroup = chunkedGroups.getLastGroup(lock);
+            if (!lastChunkedGroup || lastChunkedGroup->isFullOrOnDisk()) {
+                chunkedGroups.appendGroup(lock,
+                    std::make_unique<ChunkedNodeGroup>(memoryManager, dataTypes,
+                        enableCompression, ChunkedNodeGroup::CHUNK_CAPACITY, numRows,
+                        ResidencyState::IN_MEMORY));
+                lastChunkedGroup = chunkedGroups.getLastGroup(lock);
+            }
+            const auto numAppended = lastChunkedGroup->append(&DUMMY_TRANSACTION, chunksToAppend,
+                numRowsAppended, run->getNumRows() - numRowsAppended);
+            numRowsAppended += numAppended;
+            numRows += numAppended;
+        }
+    }
+    nextRowToAppend = numRows.load();
 }
 
 void CSRNodeGroup::checkpoint(MemoryManager&, NodeGroupCheckpointState& state) {
@@ -441,9 +558,88 @@ void CSRNodeGroup::checkpoint(MemoryManager&, NodeGroupCheckpointState& state) {
         checkpointInMemOnly(lock, state);
         return;
     }
+    const auto& csrState = state.cast<CSRNodeGroupCheckpointState>();
+    if (canDeferMerge(lock, csrState)) {
+        checkpointDeltaRun(lock, csrState);
+        return;
+    }
     checkpointInMemAndOnDisk(lock, state);
 }
 
+bool CSRNodeGroup::canDeferMerge(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState) {
+    // Sorted adjacency lists are only guaranteed after merging into the persistent CSR.
+    if (csrState.deltaMergeRatio <= 0 || csrState.sortByNbrOffset || !csrIndex) {
+        return false;
+    }
+    // The column set must not have changed since the persistent data and delta runs were written.
+    const auto numColumns = csrState.columnIDs.size();
+    if (persistentChunkGroup->getNumColumns() != numColumns) {
+        return false;
+    }
+    for (auto i = 0u; i < numColumns; i++) {
+        if (csrState.columnIDs[i] != i) {
+            return false;
+        }
+    }
+    for (auto& run : deltaRuns) {
+        if (run->getNumColumns() != numColumns) {
+            return false;
+        }
+    }
+    // Updates and deletions are only applied by merging.
+    if (persistentChunkGroup->hasUpdates() ||
+        persistentChunkGroup->hasDeletions(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        return false;
+    }
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        if (chunkedGroup->hasUpdates() ||
+            chunkedGroup->hasDeletions(&DUMMY_CHECKPOINT_TRANSACTION)) {
+            return false;
+        }
+    }
+    return static_cast<double>(numRows.load()) <=
+           csrState.deltaMergeRatio * static_cast<double>(persistentChunkGroup->getNumRows());
+}
+
+row_idx_t CSRNodeGroup::getNumRowsInDeltaRuns() const {
+    row_idx_t numRowsInRuns = 0;
+    for (auto& run : deltaRuns) {
+        numRowsInRuns += run->getNumRows();
+    }
+    return numRowsInRuns;
+}
+
+void CSRNodeGroup::checkpointDeltaRun(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState) {
+    const auto startRow = getNumRowsInDeltaRuns();
+    const auto endRow = numRows.load();
+    KU_ASSERT(startRow <= endRow);
+    if (startRow < endRow) {
+        std::vector<std::unique_ptr<ColumnChunk>> runChunks;
+        for (const auto columnID : csrState.columnIDs) {
+            auto chunkData = ColumnChunkFactory::createColumnChunkData(*csrState.mm,
+                dataTypes[columnID].copy(), enableCompression, endRow - startRow,
+                ResidencyState::IN_MEMORY);
+            auto row = startRow;
+            while (row < endRow) {
+                const auto [chunkIdx, rowInChunk] =
+                    StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+                const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
+                const auto numRowsToAppend =
+                    std::min(chunkedGroup->getNumRows() - rowInChunk, endRow - row);
+                chunkData->append(&chunkedGroup->getColumnChunk(columnID).getData(), rowInChunk,
+                    numRowsToAppend);
+                row += numRowsToAppend;
+            }
+            runChunks.push_back(std::make_unique<ColumnChunk>(enableCompression,
+                Column::flushChunkData(*chunkData, csrState.dataFH)));
+        }
+        deltaRuns.push_back(std::make_unique<ChunkedNodeGroup>(std::move(runChunks), startRow));
+    }
+    persistentChunkGroup->resetVersionAndUpdateInfo();
+}
+
 void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheckpointState& state) {
     // TODO(Guodong): Should skip early here if no changes in the node group, so we avoid scanning
     // the csr header. Case: No insertions/deletions in persistent chunk and no in-mem chunks.
@@ -469,6 +665,10 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
             persistentChunkGroup = std::make_unique<ChunkedCSRNodeGroup>(
                 persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState.columnIDs);
         }
+        if (!deltaRuns.empty()) {
+            // All rows in delta runs have been deleted.
+            finalizeCheckpoint(lock);
+        }
         return;
     }
     if (regionsToCheckpoint.size() == 1 &&
@@ -485,8 +685,16 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
         }
     }
     KU_ASSERT(csrState.newHeader->sanityCheck());
+    std::vector<std::vector<bool>> mergeOrders;
+    if (csrState.sortByNbrOffset && csrIndex) {
+        for (auto& region : regionsToCheckpoint) {
+            mergeOrders.push_back(region.hasInsertions ?
+                                      computeMergeOrderInRegion(lock, csrState, region) :
+                                      std::vector<bool>{});
+        }
+    }
     for (const auto columnID : csrState.columnIDs) {
-        checkpointColumn(lock, columnID, csrState, regionsToCheckpoint);
+        checkpointColumn(lock, columnID, csrState, regionsToCheckpoint, mergeOrders);
     }
     checkpointCSRHeaderColumns(csrState);
     persistentChunkGroup = std::make_unique<ChunkedCSRNodeGroup>(
@@ -521,16 +729,92 @@ void CSRNodeGroup::redistributeCSRRegions(const CSRNodeGroupCheckpointState& csr
     csrState.newHeader->finalizeCSRRegionEndOffsets(rightCSROffsetOfRegions);
 }
 
+row_idx_vec_t CSRNodeGroup::getInMemRowsToCheckpoint(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState, offset_t nodeOffset) {
+    auto rows = csrIndex->indices[nodeOffset].getRows();
+    if (!csrState.sortByNbrOffset) {
+        return rows;
+    }
+    std::vector<std::pair<offset_t, row_idx_t>> nbrOffsetAndRows;
+    nbrOffsetAndRows.reserve(rows.size());
+    for (const auto row : rows) {
+        if (row != INVALID_ROW_IDX) {
+            nbrOffsetAndRows.emplace_back(getInMemNbrOffset(lock, row), row);
+        }
+    }
+    std::sort(nbrOffsetAndRows.begin(), nbrOffsetAndRows.end());
+    for (auto i = 0u; i < rows.size(); i++) {
+        rows[i] = i < nbrOffsetAndRows.size() ? nbrOffsetAndRows[i].second : INVALID_ROW_IDX;
+    }
+    return rows;
+}
+
+offset_t CSRNodeGroup::getInMemNbrOffset(const UniqLock& lock, row_idx_t row) {
+    auto [chunkIdx, rowInChunk] =
+        StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+    return chunkedGroups.getGroup(lock, chunkIdx)
+        ->getColumnChunk(NBR_ID_COLUMN_ID)
+        .getData()
+        .getValue<offset_t>(rowInChunk);
+}
+
+std::vector<bool> CSRNodeGroup::computeMergeOrderInRegion(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region) {
+    const auto leftCSROffset = csrState.oldHeader->getStartCSROffset(region.leftNodeOffset);
+    const auto rightCSROffset = csrState.oldHeader->getEndCSROffset(region.rightNodeOffset);
+    const auto numOldRowsInRegion = rightCSROffset - leftCSROffset;
+    const auto oldNbrChunk = std::make_unique<ColumnChunk>(*csrState.mm,
+        dataTypes[NBR_ID_COLUMN_ID].copy(), numOldRowsInRegion, false, ResidencyState::IN_MEMORY);
+    ChunkState chunkState;
+    const auto& persistentChunk = persistentChunkGroup->getColumnChunk(NBR_ID_COLUMN_ID);
+    persistentChunk.initializeScanState(chunkState, csrState.columns[NBR_ID_COLUMN_ID].get());
+    persistentChunk.scanCommitted<ResidencyState::ON_DISK>(&DUMMY_CHECKPOINT_TRANSACTION,
+        chunkState, *oldNbrChunk, leftCSROffset, numOldRowsInRegion);
+    std::vector<bool> mergeOrder;
+    for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
+         nodeOffset++) {
+        auto oldRow = csrState.oldHeader->getStartCSROffset(nodeOffset) - leftCSROffset;
+        const auto oldEndRow = oldRow + csrState.oldHeader->getCSRLength(nodeOffset);
+        const auto inMemRows = getInMemRowsToCheckpoint(lock, csrState, nodeOffset);
+        auto inMemIdx = 0u;
+        // Deleted persistent rows and invalid in-memory rows are skipped the same way as in
+        // checkpointColumnInRegion.
+        while (oldRow < oldEndRow || inMemIdx < inMemRows.size()) {
+            if (oldRow < oldEndRow && region.hasPersistentDeletions &&
+                persistentChunkGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION,
+                    oldRow + leftCSROffset)) {
+                oldRow++;
+                continue;
+            }
+            if (inMemIdx < inMemRows.size() && inMemRows[inMemIdx] == INVALID_ROW_IDX) {
+                inMemIdx++;
+                continue;
+            }
+            const bool takeOld =
+                inMemIdx == inMemRows.size() ||
+                (oldRow < oldEndRow && oldNbrChunk->getData().getValue<offset_t>(oldRow) <=
+                                           getInMemNbrOffset(lock, inMemRows[inMemIdx]));
+            mergeOrder.push_back(takeOld);
+            takeOld ? oldRow++ : inMemIdx++;
+        }
+    }
+    return mergeOrder;
+}
+
 void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
-    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) {
+    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+    const std::vector<std::vector<bool>>& mergeOrders) {
     std::vector<ChunkCheckpointState> chunkCheckpointStates;
     chunkCheckpointStates.reserve(regions.size());
-    for (auto& region : regions) {
+    static const std::vector<bool> noMergeOrder;
+    for (auto i = 0u; i < regions.size(); i++) {
+        auto& region = regions[i];
         if (!region.needCheckpointColumn(columnID)) {
             // Skip checkpoint for the column if it has no changes in the region.
             continue;
         }
-        auto regionCheckpointState = checkpointColumnInRegion(lock, columnID, csrState, region);
+        auto regionCheckpointState = checkpointColumnInRegion(lock, columnID, csrState, region,
+            mergeOrders.empty() ? noMergeOrder : mergeOrders[i]);
         if (regionCheckpointState.numRows == 0) {
             // Skip the case when we have no rows to write for the region. This can happen when all
             // rows are deleted within the region. We don't aggressively reclaim the space in the
@@ -545,7 +829,8 @@ void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
 }
 
 ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock,
-    column_id_t columnID, const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region) {
+    column_id_t columnID, const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region,
+    const std::vector<bool>& mergeOrder) {
     const auto leftCSROffset = csrState.oldHeader->getStartCSROffset(region.leftNodeOffset);
     const auto rightCSROffset = csrState.oldHeader->getEndCSROffset(region.rightNodeOffset);
     const auto numOldRowsInRegion = rightCSROffset - leftCSROffset;
@@ -564,6 +849,15 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
     const auto dummyChunkForNulls = std::make_unique<ColumnChunk>(*csrState.mm,
         dataTypes[columnID].copy(), DEFAULT_VECTOR_CAPACITY, false, ResidencyState::IN_MEMORY);
     dummyChunkForNulls->getData().resetToAllNull();
+    const auto appendInMemRow = [&](row_idx_t row) {
+        auto [chunkIdx, rowInChunk] =
+            StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+        const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
+        KU_ASSERT(!chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk));
+        chunkedGroup->getColumnChunk(columnID).scanCommitted<ResidencyState::IN_MEMORY>(
+            &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *newChunk, rowInChunk, 1);
+    };
+    auto mergeOrderIdx = 0u;
     // Copy per csr list from old chunk and merge with new insertions into the newChunkData.
     for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
          nodeOffset++) {
@@ -573,8 +867,31 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
         const auto newStartRow = csrState.newHeader->getStartCSROffset(nodeOffset) - leftCSROffset;
         KU_ASSERT(newStartRow == newChunk->getData().getNumValues());
         KU_UNUSED(newStartRow);
-        // Copy old csr list with updates into the new chunk.
-        if (!region.hasPersistentDeletions) {
+        if (!mergeOrder.empty()) {
+            // Interleave old rows and in-memory insertions by neighbour offset.
+            auto oldRow = oldStartRow;
+            const auto oldEndRow = oldStartRow + oldCSRLength;
+            const auto inMemRows = getInMemRowsToCheckpoint(lock, csrState, nodeOffset);
+            auto inMemIdx = 0u;
+            while (oldRow < oldEndRow || inMemIdx < inMemRows.size()) {
+                if (oldRow < oldEndRow && region.hasPersistentDeletions &&
+                    persistentChunkGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION,
+                        oldRow + leftCSROffset)) {
+                    oldRow++;
+                    continue;
+                }
+                if (inMemIdx < inMemRows.size() && inMemRows[inMemIdx] == INVALID_ROW_IDX) {
+                    inMemIdx++;
+                    continue;
+                }
+                KU_ASSERT(mergeOrderIdx < mergeOrder.size());
+                if (mergeOrder[mergeOrderIdx++]) {
+                    newChunk->getData().append(&oldChunkWithUpdates->getData(), oldRow++, 1);
+                } else {
+                    appendInMemRow(inMemRows[inMemIdx++]);
+                }
+            }
+        } else if (!region.hasPersistentDeletions) {
             newChunk->getData().append(&oldChunkWithUpdates->getData(), oldStartRow, oldCSRLength);
         } else {
             // TODO(Guodong): Optimize the for loop away by appending in batch
@@ -588,7 +905,7 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
             }
         }
         // Merge in-memory insertions into the new chunk.
-        if (csrIndex) {
+        if (csrIndex && mergeOrder.empty()) {
             auto rows = csrIndex->indices[nodeOffset].getRows();
             // TODO(Guodong): Optimize here. if no deletions and has sequential rows, scan in
             // range.
@@ -596,12 +913,7 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
                 if (row == INVALID_ROW_IDX) {
                     continue;
                 }
-                auto [chunkIdx, rowInChunk] =
-                    StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
-                const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
-                KU_ASSERT(!chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk));
-                chunkedGroup->getColumnChunk(columnID).scanCommitted<ResidencyState::IN_MEMORY>(
-                    &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *newChunk, rowInChunk, 1);
+                appendInMemRow(row);
             }
         }
         // Fill gaps if any.
@@ -780,7 +1092,7 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     // Scan tuples from in mem node groups and append to data chunks to flush.
     for (auto offset = 0u; offset < numNodes; offset++) {
         const auto numRows = csrIndex->getNumRows(offset);
-        auto rows = csrIndex->indices[offset].getRows();
+        auto rows = getInMemRowsToCheckpoint(lock, csrState, offset);
         auto numRowsTryAppended = 0u;
         while (numRowsTryAppended < numRows) {
             const auto maxNumRowsToAppend =
@@ -834,6 +1146,7 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     // Set `numRows` back to 0 is to reflect that the in mem part of the node group is empty.
     numRows = 0;
     csrIndex.reset();
+    deltaRuns.clear();
 }
 
 void CSRNodeGroup::initScanStateFromScanChunk(const CSRNodeGroupCheckpointState& csrState,
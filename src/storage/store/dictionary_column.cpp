@@ -53,48 +53,38 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& state,
 
 void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetState,
     const ChunkState& dataState, std::vector<std::pair<string_index_t, uint64_t>>& offsetsToScan,
-    ValueVector* resultVector, const ColumnChunkMetadata& indexMeta) {
-    string_index_t firstOffsetToScan = 0, lastOffsetToScan = 0;
+    ValueVector* resultVector) {
     auto comp = [](auto pair1, auto pair2) { return pair1.first < pair2.first; };
-    auto duplicationFactor = (double)offsetState.metadata.numValues / indexMeta.numValues;
-    if (duplicationFactor <= 0.5) {
-        // If at least 50% of strings are duplicated, sort the offsets so we can re-use scanned
-        // strings
-        std::sort(offsetsToScan.begin(), offsetsToScan.end(), comp);
-        firstOffsetToScan = offsetsToScan.front().first;
-        lastOffsetToScan = offsetsToScan.back().first;
-    } else {
-        const auto& [min, max] =
-            std::minmax_element(offsetsToScan.begin(), offsetsToScan.end(), comp);
-        firstOffsetToScan = min->first;
-        lastOffsetToScan = max->first;
-    }
+    const auto& [min, max] = std::minmax_element(offsetsToScan.begin(), offsetsToScan.end(), comp);
+    const auto firstOffsetToScan = min->first;
+    const auto lastOffsetToScan = max->first;
     // TODO(bmwinger): scan batches of adjacent values.
     // Ideally we scan values together until we reach empty pages
     // This would also let us use the same optimization for the data column,
     // where the worst case for the current method is much worse
 
-    // Note that the list will contain duplicates when indices are duplicated.
-    // Each distinct value is scanned once, and re-used when writing to each output value
     auto numOffsetsToScan = lastOffsetToScan - firstOffsetToScan + 1;
     // One extra offset to scan for the end offset of the last string
     std::vector<string_offset_t> offsets(numOffsetsToScan + 1);
     scanOffsets(transaction, offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
 
-    for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
-        auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
-        auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
-        scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
-            offsetsToScan[pos].second);
-        auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
-        // For each string which has the same index in the dictionary as the one we scanned,
-        // copy the scanned string to its position in the result vector
-        while (pos + 1 < offsetsToScan.size() &&
-               offsetsToScan[pos + 1].first == offsetsToScan[pos].first) {
-            pos++;
-            resultVector->setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
+    // The list contains duplicates when indices are duplicated. Each distinct value is scanned
+    // once, and the other positions with the same index share the scanned string, including its
+    // overflow data, so that e.g. hashing can recognise them without comparing their content.
+    std::vector<uint64_t> scannedPositions(numOffsetsToScan, INVALID_SCANNED_POS);
+    for (auto& [index, posInVector] : offsetsToScan) {
+        auto& scannedPos = scannedPositions[index - firstOffsetToScan];
+        if (scannedPos != INVALID_SCANNED_POS) {
+            resultVector->getValue<ku_string_t>(posInVector) =
+                resultVector->getValue<ku_string_t>(scannedPos);
+            continue;
         }
+        scannedPos = posInVector;
+        auto startOffset = offsets[index - firstOffsetToScan];
+        auto endOffset = offsets[index - firstOffsetToScan + 1];
+        scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
+            posInVector);
     }
 }
 
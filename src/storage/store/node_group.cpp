@@ -150,8 +150,20 @@ NodeGroupScanResult NodeGroup::scan(Transaction* transaction, TableScanState& st
         const auto startNodeOffset = nodeGroupScanState.numScannedRows +
                                      StorageUtils::getStartOffsetOfNodeGroup(state.nodeGroupIdx);
         if (!state.semiMask->isAnyMasked(startNodeOffset, startNodeOffset + numRowsToScan - 1)) {
+            // Skip all vectors of the chunked group before the one holding the next masked
+            // offset.
+            const auto nextMaskedOffset = state.semiMask->getNextMaskedOffset(startNodeOffset);
+            const auto numRowsLeftInChunk = chunkedGroupToScan.getNumRows() - rowIdxInChunkToScan;
+            auto numRowsToSkip = numRowsLeftInChunk;
+            if (nextMaskedOffset != INVALID_OFFSET) {
+                const auto numRowsBeforeNextMasked = (nextMaskedOffset - startNodeOffset) /
+                                                     DEFAULT_VECTOR_CAPACITY *
+                                                     DEFAULT_VECTOR_CAPACITY;
+                numRowsToSkip = std::max(numRowsToScan,
+                    std::min(numRowsLeftInChunk, numRowsBeforeNextMasked));
+            }
             state.outState->getSelVectorUnsafe().setSelSize(0);
-            nodeGroupScanState.numScannedRows += numRowsToScan;
+            nodeGroupScanState.numScannedRows += numRowsToSkip;
             return NodeGroupScanResult{nodeGroupScanState.numScannedRows, 0};
         }
     }
@@ -426,8 +438,10 @@ std::unique_ptr<NodeGroup> NodeGroup::deserialize(MemoryManager& memoryManager,
             chunkedNodeGroup = std::make_unique<ChunkedCSRNodeGroup>(memoryManager, columnTypes,
                 true, 0, 0, ResidencyState::IN_MEMORY);
         }
-        return std::make_unique<CSRNodeGroup>(nodeGroupIdx, enableCompression,
+        auto csrNodeGroup = std::make_unique<CSRNodeGroup>(nodeGroupIdx, enableCompression,
             std::move(chunkedNodeGroup));
+        csrNodeGroup->deserializeDeltaRuns(memoryManager, deSer);
+        return csrNodeGroup;
     }
     default: {
         KU_UNREACHABLE;
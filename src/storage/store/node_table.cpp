@@ -137,6 +137,20 @@ bool NodeTable::lookup(Transaction* transaction, const TableScanState& scanState
     return scanState.nodeGroup->lookup(transaction, scanState);
 }
 
+bool NodeTable::lookupMultiple(Transaction* transaction, const TableScanState& scanState) const {
+    auto startOffset = StorageUtils::getStartOffsetOfNodeGroup(scanState.nodeGroupIdx);
+    if (scanState.source == TableScanSource::UNCOMMITTED) {
+        startOffset += StorageConstants::MAX_NUM_ROWS_IN_TABLE;
+    }
+    scanState.nodeIDVector->state->getSelVector().forEach([&](auto pos) {
+        KU_ASSERT(!scanState.nodeIDVector->isNull(pos));
+        const auto nodeOffset = scanState.nodeIDVector->readNodeOffset(pos);
+        KU_ASSERT(nodeOffset >= startOffset);
+        scanState.rowIdxVector->setValue<row_idx_t>(pos, nodeOffset - startOffset);
+    });
+    return scanState.nodeGroup->lookup(transaction, scanState);
+}
+
 offset_t NodeTable::validateUniquenessConstraint(const Transaction* transaction,
     const std::vector<ValueVector*>& propertyVectors) const {
     const auto pkVector = propertyVectors[pkColumnID];
@@ -371,7 +385,8 @@ void NodeTable::insertPK(const Transaction* transaction, const ValueVector& node
     }
 }
 
-void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
+void NodeTable::checkpoint(main::ClientContext* context, Serializer& ser,
+    TableCatalogEntry* tableEntry) {
     if (hasChanges) {
         // Deleted columns are vaccumed and not checkpointed or serialized.
         std::vector<std::unique_ptr<Column>> checkpointColumns;
@@ -384,7 +399,7 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumns), *dataFH,
             memoryManager};
         nodeGroups->checkpoint(*memoryManager, state);
-        pkIndex->checkpoint();
+        pkIndex->checkpoint(context);
         hasChanges = false;
         columns = std::move(state.columns);
         tableEntry->vacuumColumnIDs(0);
@@ -415,7 +430,8 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
             LocalStorage::NotExistAction::RETURN_NULL);
         if (localTable &&
-            localTable->cast<LocalNodeTable>().lookupPK(transaction, keyVector, result)) {
+            localTable->cast<LocalNodeTable>().lookupPK(transaction, keyVector, vectorPos,
+                result)) {
             return true;
         }
     }
@@ -423,5 +439,26 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
 }
 
+void NodeTable::lookupPKs(const Transaction* transaction, ValueVector* keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results) const {
+    KU_ASSERT(positions.size() == results.size());
+    std::fill(results.begin(), results.end(), INVALID_OFFSET);
+    if (transaction->getLocalStorage()) {
+        if (const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
+                LocalStorage::NotExistAction::RETURN_NULL)) {
+            auto& localNodeTable = localTable->cast<LocalNodeTable>();
+            for (auto i = 0u; i < positions.size(); i++) {
+                offset_t result = INVALID_OFFSET;
+                if (localNodeTable.lookupPK(transaction, keyVector, positions[i], result)) {
+                    results[i] = result;
+                }
+            }
+        }
+    }
+    // Keys found in the local table are already resolved and are skipped by the index.
+    pkIndex->lookup(transaction, keyVector, positions, results,
+        [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "main/client_context.h"
+#include "main/db_config.h"
 #include "storage/local_storage/local_rel_table.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/local_storage/local_table.h"
@@ -166,6 +167,32 @@ bool RelTable::scanInternal(Transaction* transaction, TableScanState& scanState)
     return scanState.scanNext(transaction);
 }
 
+row_idx_t RelTable::countRels(Transaction* transaction, RelTableScanState& relScanState,
+    offset_t boundNodeOffset) const {
+    row_idx_t numRels = 0;
+    if (boundNodeOffset < StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundNodeOffset);
+        auto nodeGroup = relScanState.nodeGroup;
+        if (relScanState.nodeGroupIdx != nodeGroupIdx || !nodeGroup) {
+            nodeGroup = getDirectedTableData(relScanState.direction)->getNodeGroup(nodeGroupIdx);
+        }
+        if (nodeGroup) {
+            numRels += nodeGroup->cast<CSRNodeGroup>().countRels(transaction, relScanState,
+                boundNodeOffset % StorageConstants::NODE_GROUP_SIZE);
+        }
+    }
+    if (relScanState.localTableScanState && relScanState.localTableScanState->localRelTable) {
+        const auto localRelTable = relScanState.localTableScanState->localRelTable;
+        const auto& index = relScanState.direction == RelDataDirection::FWD ?
+                                localRelTable->getFWDIndex() :
+                                localRelTable->getBWDIndex();
+        if (index.contains(boundNodeOffset)) {
+            numRels += index.at(boundNodeOffset).size();
+        }
+    }
+    return numRels;
+}
+
 void RelTable::insert(Transaction* transaction, TableInsertState& insertState) {
     KU_ASSERT(transaction->getLocalStorage());
     const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
@@ -473,7 +500,8 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction, NodeGro
     }
 }
 
-void RelTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
+void RelTable::checkpoint(main::ClientContext* context, Serializer& ser,
+    TableCatalogEntry* tableEntry) {
     if (hasChanges) {
         // Deleted columns are vaccumed and not checkpointed or serialized.
         std::vector<column_id_t> columnIDs;
@@ -481,8 +509,11 @@ void RelTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         for (auto& property : tableEntry->getProperties()) {
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
-        fwdRelTableData->checkpoint(columnIDs);
-        bwdRelTableData->checkpoint(columnIDs);
+        const auto sortByNbrOffset =
+            tableEntry->constCast<RelTableCatalogEntry>().hasSortedAdjacencyLists();
+        const auto deltaMergeRatio = context->getDBConfig()->relDeltaMergeRatio;
+        fwdRelTableData->checkpoint(columnIDs, sortByNbrOffset, deltaMergeRatio);
+        bwdRelTableData->checkpoint(columnIDs, sortByNbrOffset, deltaMergeRatio);
         tableEntry->vacuumColumnIDs(1);
         hasChanges = false;
     }
@@ -30,6 +30,14 @@ RelTableData::RelTableData(FileHandle* dataFH, MemoryManager* mm, ShadowFile* sh
     initPropertyColumns(tableEntry);
     nodeGroups = std::make_unique<NodeGroupCollection>(*mm, getColumnTypes(), enableCompression,
         dataFH, deSer);
+    if (deSer) {
+        for (auto nodeGroupIdx = 0u; nodeGroupIdx < nodeGroups->getNumNodeGroups();
+             nodeGroupIdx++) {
+            nodeGroups->getNodeGroup(nodeGroupIdx)
+                ->cast<CSRNodeGroup>()
+                .loadDeltaRuns(*mm, columns);
+        }
+    }
 }
 
 void RelTableData::initCSRHeaderColumns() {
@@ -190,7 +198,8 @@ void RelTableData::checkIfNodeHasRels(Transaction* transaction,
     }
 }
 
-void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
+void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs, bool sortByNbrOffset,
+    double deltaMergeRatio) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -198,6 +207,8 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
     }
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumns), *dataFH,
         memoryManager, csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+    state.sortByNbrOffset = sortByNbrOffset;
+    state.deltaMergeRatio = deltaMergeRatio;
     nodeGroups->checkpoint(*memoryManager, state);
     columns = std::move(state.columns);
 }
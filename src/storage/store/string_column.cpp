@@ -88,11 +88,10 @@ void StringColumn::lookupInternal(Transaction* transaction, const ChunkState& st
     string_index_t index = 0;
     indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX), offsetInChunk,
         offsetInChunk + 1, reinterpret_cast<uint8_t*>(&index));
-    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan(1);
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
     offsetsToScan.emplace_back(index, posInVector);
     dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
-        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
-        getChildState(state, ChildStateIndex::INDEX).metadata);
+        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector);
 }
 
 void StringColumn::write(ColumnChunkData& persistentChunk, ChunkState& state, offset_t dstOffset,
@@ -162,8 +161,7 @@ void StringColumn::scanUnfiltered(Transaction* transaction, const ChunkState& st
         return;
     }
     dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
-        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
-        getChildState(state, ChildStateIndex::INDEX).metadata);
+        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector);
 }
 
 void StringColumn::scanFiltered(Transaction* transaction, const ChunkState& state,
@@ -186,8 +184,7 @@ void StringColumn::scanFiltered(Transaction* transaction, const ChunkState& stat
         return;
     }
     dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
-        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
-        getChildState(state, ChildStateIndex::INDEX).metadata);
+        getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector);
 }
 
 bool StringColumn::canCheckpointInPlace(const ChunkState& state,
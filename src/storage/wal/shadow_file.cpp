@@ -50,7 +50,8 @@ ShadowFile::ShadowFile(const std::string& directory, bool readOnly, BufferManage
 }
 
 void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::lock_guard lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         shadowPagesMap.at(originalFile).erase(originalPage);
         if (shadowPagesMap.at(originalFile).empty()) {
             shadowPagesMap.erase(originalFile);
@@ -60,7 +61,8 @@ void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPag
 
 page_idx_t ShadowFile::getOrCreateShadowPage(DBFileID dbFileID, file_idx_t originalFile,
     page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::lock_guard lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         return shadowPagesMap[originalFile][originalPage];
     }
     const auto shadowPageIdx = shadowingFH->addNewPage();
@@ -70,7 +72,8 @@ page_idx_t ShadowFile::getOrCreateShadowPage(DBFileID dbFileID, file_idx_t origi
 }
 
 page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
-    KU_ASSERT(hasShadowPage(originalFile, originalPage));
+    std::lock_guard lck{mtx};
+    KU_ASSERT(hasShadowPageNoLock(originalFile, originalPage));
     return shadowPagesMap.at(originalFile).at(originalPage);
 }
 
@@ -135,6 +135,9 @@ TEST_F(CApiQueryResultTest, GetQuerySummary) {
     ASSERT_EQ(state, KuzuSuccess);
     auto compilingTime = kuzu_query_summary_get_compiling_time(&summary);
     ASSERT_GT(compilingTime, 0);
+    auto planningTime = kuzu_query_summary_get_planning_time(&summary);
+    ASSERT_GT(planningTime, 0);
+    ASSERT_LE(planningTime, compilingTime);
     auto executionTime = kuzu_query_summary_get_execution_time(&summary);
     ASSERT_GT(executionTime, 0);
     kuzu_query_summary_destroy(&summary);
@@ -238,3 +241,42 @@ TEST_F(CApiQueryResultTest, MultipleQuery) {
 
     kuzu_query_result_destroy(&result);
 }
+
+TEST_F(CApiQueryResultTest, StreamedQueryFailsMidStream) {
+    kuzu_query_result result;
+    auto connection = getConnection();
+    ASSERT_EQ(kuzu_connection_set_stream_results(connection, true), KuzuSuccess);
+    auto state = kuzu_connection_query(connection,
+        "UNWIND range(1, 100000) AS i RETURN CAST(CASE WHEN i = 90000 THEN 'x' ELSE string(i) END "
+        "AS INT64)",
+        &result);
+    ASSERT_EQ(state, KuzuSuccess);
+    // Tuples before the failing one may be read, then the iteration stops.
+    auto numTuples = 0u;
+    kuzu_flat_tuple flatTuple;
+    while (kuzu_query_result_has_next(&result)) {
+        ASSERT_EQ(kuzu_query_result_get_next(&result, &flatTuple), KuzuSuccess);
+        numTuples++;
+    }
+    ASSERT_LT(numTuples, 90000u);
+    ASSERT_EQ(kuzu_query_result_get_next(&result, &flatTuple), KuzuError);
+    ASSERT_FALSE(kuzu_query_result_is_success(&result));
+    const auto expectedError =
+        std::string("Conversion exception: Cast failed. Could not convert \"x\" to INT64.");
+    char* errorMessage = kuzu_query_result_get_error_message(&result);
+    ASSERT_EQ(std::string(errorMessage), expectedError);
+    kuzu_destroy_string(errorMessage);
+    char* str = kuzu_query_result_to_string(&result);
+    ASSERT_EQ(std::string(str), expectedError);
+    kuzu_destroy_string(str);
+    ArrowArray arrowArray;
+    ASSERT_EQ(kuzu_query_result_get_next_arrow_chunk(&result, 100, &arrowArray), KuzuError);
+    kuzu_query_result_reset_iterator(&result);
+    kuzu_query_result_destroy(&result);
+    // The connection can still be used after the failed stream.
+    state = kuzu_connection_query(connection, "MATCH (a:person) RETURN COUNT(*)", &result);
+    ASSERT_EQ(state, KuzuSuccess);
+    ASSERT_TRUE(kuzu_query_result_is_success(&result));
+    ASSERT_EQ(kuzu_query_result_get_num_tuples(&result), 1);
+    kuzu_query_result_destroy(&result);
+}
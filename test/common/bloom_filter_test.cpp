@@ -0,0 +1,79 @@
+#include "common/bloom_filter.h"
+#include "function/hash/hash_functions.h"
+#include "graph_test/graph_test.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace testing {
+
+class BloomFilterTests : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    storage::MemoryManager& getMM() const { return *getMemoryManager(*database); }
+};
+
+TEST_F(BloomFilterTests, UnsizedFilterContainsEverything) {
+    BloomFilter bloomFilter;
+    ASSERT_TRUE(bloomFilter.mayContain(0));
+    ASSERT_TRUE(bloomFilter.mayContain(12345));
+}
+
+TEST_F(BloomFilterTests, EmptyFilterContainsNothing) {
+    BloomFilter bloomFilter;
+    bloomFilter.reset(getMM(), 0);
+    for (auto i = 0; i < 1000; i++) {
+        ASSERT_FALSE(bloomFilter.mayContain(murmurhash64(i)));
+    }
+}
+
+TEST_F(BloomFilterTests, NoFalseNegatives) {
+    BloomFilter bloomFilter;
+    bloomFilter.reset(getMM(), 10000);
+    for (auto i = 0; i < 10000; i += 2) {
+        bloomFilter.insert(murmurhash64(i));
+    }
+    auto numFalsePositives = 0u;
+    for (auto i = 0; i < 10000; i++) {
+        if (i % 2 == 0) {
+            ASSERT_TRUE(bloomFilter.mayContain(murmurhash64(i)));
+        } else {
+            numFalsePositives += bloomFilter.mayContain(murmurhash64(i));
+        }
+    }
+    // The false positive rate is far below 1% with 32 bits per inserted key.
+    ASSERT_LT(numFalsePositives, 100u);
+}
+
+TEST_F(BloomFilterTests, ResetReleasesMemory) {
+    auto bm = getBufferManager(*database);
+    auto initialMemoryUsage = bm->getUsedMemory();
+    {
+        BloomFilter bloomFilter;
+        bloomFilter.reset(getMM(), 1000000);
+        ASSERT_GT(bm->getUsedMemory(), initialMemoryUsage);
+        bloomFilter.reset(getMM(), 1000000);
+    }
+    ASSERT_EQ(bm->getUsedMemory(), initialMemoryUsage);
+}
+
+TEST_F(BloomFilterTests, FilterIsSkippedWhenMemoryIsUnavailable) {
+    conn.reset();
+    systemConfig->bufferPoolSize = 16 * 1024 * 1024;
+    createDBAndConn();
+    BloomFilter bloomFilter;
+    // The filter is capped at 32MB, which still does not fit in the buffer pool.
+    bloomFilter.reset(getMM(), (uint64_t)1 << 30);
+    for (auto i = 0; i < 1000; i++) {
+        ASSERT_TRUE(bloomFilter.mayContain(murmurhash64(i)));
+    }
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,90 @@
+#include <set>
+
+#include "common/roaring_bitmap.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+
+static void assertEquals(const RoaringBitmap& bitmap, const std::set<offset_t>& expected) {
+    ASSERT_EQ(bitmap.getCardinality(), expected.size());
+    std::set<offset_t> result;
+    for (auto offset = bitmap.getNextSetOffset(0); offset != INVALID_OFFSET;
+         offset = bitmap.getNextSetOffset(offset + 1)) {
+        result.insert(offset);
+    }
+    ASSERT_EQ(result, expected);
+}
+
+TEST(RoaringBitmapTests, TestSparseContainer) {
+    RoaringBitmap bitmap;
+    std::set<offset_t> expected{3, 70000, 70001, 1ull << 33};
+    for (auto offset : expected) {
+        bitmap.add(offset);
+        bitmap.add(offset);
+    }
+    assertEquals(bitmap, expected);
+    ASSERT_TRUE(bitmap.contains(70000));
+    ASSERT_FALSE(bitmap.contains(69999));
+    ASSERT_FALSE(bitmap.contains(1ull << 40));
+    ASSERT_TRUE(bitmap.containsAny(4, 70000));
+    ASSERT_FALSE(bitmap.containsAny(4, 69999));
+    ASSERT_FALSE(bitmap.containsAny(70002, (1ull << 33) - 1));
+    ASSERT_EQ(bitmap.getNextSetOffset(70002), 1ull << 33);
+}
+
+TEST(RoaringBitmapTests, TestDenseContainer) {
+    RoaringBitmap bitmap;
+    std::set<offset_t> expected;
+    // Enough values in the first chunk to switch it to a dense container.
+    for (auto offset = 0u; offset < 20000; offset += 3) {
+        bitmap.add(offset);
+        expected.insert(offset);
+    }
+    assertEquals(bitmap, expected);
+    ASSERT_TRUE(bitmap.contains(19998));
+    ASSERT_FALSE(bitmap.contains(19999));
+    ASSERT_TRUE(bitmap.containsAny(1, 3));
+    ASSERT_FALSE(bitmap.containsAny(19999, 65535));
+    ASSERT_EQ(bitmap.getNextSetOffset(19999), INVALID_OFFSET);
+}
+
+TEST(RoaringBitmapTests, TestUnionAndIntersection) {
+    RoaringBitmap dense, sparse, other;
+    std::set<offset_t> denseOffsets, sparseOffsets, otherOffsets;
+    for (auto offset = 0u; offset < 30000; offset += 2) {
+        dense.add(offset);
+        denseOffsets.insert(offset);
+    }
+    for (auto offset = 0u; offset < 200000; offset += 1001) {
+        sparse.add(offset);
+        sparseOffsets.insert(offset);
+    }
+    for (auto offset = 0u; offset < 30000; offset += 3) {
+        other.add(offset);
+        otherOffsets.insert(offset);
+    }
+    auto expectedUnion = denseOffsets;
+    expectedUnion.insert(sparseOffsets.begin(), sparseOffsets.end());
+    RoaringBitmap unionBitmap;
+    unionBitmap.unionWith(dense);
+    unionBitmap.unionWith(sparse);
+    assertEquals(unionBitmap, expectedUnion);
+
+    std::set<offset_t> expectedIntersection;
+    for (auto offset : denseOffsets) {
+        if (otherOffsets.contains(offset)) {
+            expectedIntersection.insert(offset);
+        }
+    }
+    dense.intersectWith(other);
+    assertEquals(dense, expectedIntersection);
+
+    std::set<offset_t> expectedSparseIntersection;
+    for (auto offset : sparseOffsets) {
+        if (expectedIntersection.contains(offset)) {
+            expectedSparseIntersection.insert(offset);
+        }
+    }
+    dense.intersectWith(sparse);
+    assertEquals(dense, expectedSparseIntersection);
+}
@@ -18,6 +18,60 @@ TEST_F(ArrowTest, getArrowResult) {
     arrowArray->release(arrowArray.get());
 }
 
+TEST_F(ArrowTest, getArrowResultColumnar) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.fName, a.isStudent, CASE WHEN a.ID < 5 THEN "
+                 "NULL ELSE a.age END ORDER BY a.ID";
+    auto result = conn->query(query);
+    auto arrowArray = result->getNextArrowChunk(5);
+    ASSERT_EQ(arrowArray->length, 5);
+    ASSERT_EQ(arrowArray->n_children, 4);
+    auto ids = (const int64_t*)arrowArray->children[0]->buffers[1];
+    ASSERT_EQ(std::vector<int64_t>(ids, ids + 5), (std::vector<int64_t>{0, 2, 3, 5, 7}));
+    auto nameOffsets = (const uint32_t*)arrowArray->children[1]->buffers[1];
+    ASSERT_EQ(std::vector<uint32_t>(nameOffsets, nameOffsets + 6),
+        (std::vector<uint32_t>{0, 5, 8, 13, 16, 25}));
+    ASSERT_EQ(std::string((const char*)arrowArray->children[1]->buffers[2], 25),
+        "AliceBobCarolDanElizabeth");
+    auto isStudent = (const uint8_t*)arrowArray->children[2]->buffers[1];
+    ASSERT_EQ(isStudent[0] & 0x1F, 0x03);
+    auto ageArray = arrowArray->children[3];
+    ASSERT_EQ(ageArray->null_count, 3);
+    ASSERT_EQ(((const uint8_t*)ageArray->buffers[0])[0] & 0x1F, 0x18);
+    auto ages = (const int64_t*)ageArray->buffers[1];
+    ASSERT_EQ(ages[3], 20);
+    ASSERT_EQ(ages[4], 20);
+    arrowArray->release(arrowArray.get());
+    arrowArray = result->getNextArrowChunk(5);
+    ASSERT_EQ(arrowArray->length, 3);
+    ASSERT_EQ(arrowArray->children[3]->null_count, 0);
+    ages = (const int64_t*)arrowArray->children[3]->buffers[1];
+    ASSERT_EQ(std::vector<int64_t>(ages, ages + 3), (std::vector<int64_t>{25, 40, 83}));
+    arrowArray->release(arrowArray.get());
+    ASSERT_FALSE(result->hasNext());
+}
+
+TEST_F(ArrowTest, getArrowArrayStream) {
+    auto result = conn->query("MATCH (a:person) RETURN a.ID ORDER BY a.ID");
+    auto stream = result->getArrowArrayStream(3);
+    ArrowSchemaWrapper schema;
+    ASSERT_EQ(stream->get_schema(stream.get(), &schema), 0);
+    ASSERT_EQ(schema.n_children, 1);
+    auto numArrays = 0u;
+    auto numTuples = 0;
+    while (true) {
+        ArrowArrayWrapper array;
+        ASSERT_EQ(stream->get_next(stream.get(), &array), 0);
+        if (array.release == nullptr) {
+            break;
+        }
+        numArrays++;
+        numTuples += array.length;
+    }
+    ASSERT_EQ(numArrays, 3);
+    ASSERT_EQ(numTuples, 8);
+    stream->release(stream.get());
+}
+
 TEST_F(ArrowTest, getArrowSchema) {
     auto query = "MATCH (a:person) RETURN a.fName as NAME";
     auto result = conn->query(query);
@@ -160,3 +160,73 @@ TEST_F(ApiTest, CreateTableAfterClosingDatabase) {
                          "MATCH (a:Test) where a.name='Alice' return a.age;");
     ASSERT_TRUE(result->isSuccess()) << result->toString();
 }
+
+TEST_F(ApiTest, StatementCache) {
+    auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_FALSE(result->getQuerySummary()->isStatementCacheHit());
+    const auto numHits = result->getQuerySummary()->getNumHits();
+    const auto numMisses = result->getQuerySummary()->getNumMisses();
+    ASSERT_GT(numMisses, 0u);
+    // Queries differing only in formatting share a cache entry.
+    result = conn->query("MATCH (a:person)\n  WHERE a.ID = 0\n  RETURN a.fName;  ");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_TRUE(result->getQuerySummary()->isStatementCacheHit());
+    ASSERT_EQ(result->getQuerySummary()->getNumHits(), numHits + 1);
+    ASSERT_EQ(result->getQuerySummary()->getNumMisses(), numMisses);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Alice");
+    // Whitespace inside string literals is significant.
+    result = conn->query("MATCH (a:person) WHERE a.fName = 'Alice ' RETURN a.fName;");
+    ASSERT_FALSE(result->getQuerySummary()->isStatementCacheHit());
+    ASSERT_FALSE(result->hasNext());
+    // Schema changes invalidate cached statements.
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Test(id INT64, PRIMARY KEY(id));")->isSuccess());
+    result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;");
+    ASSERT_FALSE(result->getQuerySummary()->isStatementCacheHit());
+    // Statements parsed in a manual transaction are not cached.
+    conn->query("BEGIN TRANSACTION;");
+    result = conn->query("MATCH (a:Test) RETURN a.id;");
+    conn->query("COMMIT;");
+    result = conn->query("MATCH (a:Test) RETURN a.id;");
+    ASSERT_FALSE(result->getQuerySummary()->isStatementCacheHit());
+}
+
+TEST_F(ApiTest, StreamResults) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID;";
+    auto expected = conn->query(query)->toString();
+    conn->setStreamResults(true);
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNumTuples(), 8);
+    ASSERT_EQ(result->toString(), expected);
+    // Executing another statement buffers the rest of a partially consumed result.
+    result = conn->query(query);
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    assertMatchPersonCountStar(conn.get());
+    auto numTuples = 1u;
+    while (result->hasNext()) {
+        result->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 8u);
+    // Destroying a partially consumed result ends its transaction.
+    result = conn->query(query);
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100});")->isSuccess());
+}
+
+TEST_F(ApiTest, DestroyStreamWhileConnectionRunsQuery) {
+    conn->setStreamResults(true);
+    for (auto i = 0; i < 20; i++) {
+        auto result = conn->query("UNWIND range(1, 1000000) AS i RETURN i;");
+        ASSERT_TRUE(result->hasNext());
+        result->getNext();
+        // Whichever finishes the stream first, its transaction ends exactly once.
+        std::thread destroyer([&result] { result.reset(); });
+        assertMatchPersonCountStar(conn.get());
+        destroyer.join();
+    }
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100});")->isSuccess());
+}
@@ -254,3 +254,28 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+TEST_F(ApiTest, PrepareFoldParameterPredicates) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.age > $x + 10 AND "
+                                           "(a.ID = $y OR a.ID = 2 OR a.ID = 3) RETURN COUNT(*)");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto result = conn->execute(preparedStatement.get(),
+        std::make_pair(std::string("x"), (int64_t)20),
+        std::make_pair(std::string("y"), (int64_t)0));
+    ASSERT_TRUE(result->hasNext());
+    checkTuple(result->getNext().get(), "2\n");
+}
+
+TEST_F(ApiTest, PrepareCastEliminationInComparison) {
+    auto preparedStatement = conn->prepare("MATCH (m:movies) WHERE m.length = $l RETURN m.name");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto result = conn->execute(preparedStatement.get(),
+        std::make_pair(std::string("l"), (int64_t)298));
+    ASSERT_TRUE(result->hasNext());
+    checkTuple(result->getNext().get(), "Roma\n");
+    ASSERT_FALSE(result->hasNext());
+    // Out of the range of INT32, so the cast cannot be eliminated.
+    result = conn->execute(preparedStatement.get(),
+        std::make_pair(std::string("l"), (int64_t)10000000000));
+    ASSERT_FALSE(result->hasNext());
+}
@@ -115,5 +115,127 @@ TEST_F(OptimizerTest, RecursiveJoinTest) {
     ASSERT_STREQ(getEncodedPlan(q2).c_str(), "RE_NO_TRACK(b)S(a)");
 }
 
+TEST_F(OptimizerTest, ExpressionRewriteTest) {
+    auto q1 = "MATCH (a:person)-[e:knows]->(b:person) "
+              "WHERE a.ID < 0 AND true AND NOT NOT a.fName = 'Alice' "
+              "RETURN e.date;";
+    ASSERT_STREQ(getEncodedPlan(q1).c_str(), "E(b)Filter()Filter()S(a)");
+    auto q2 = "MATCH (a:person) WHERE a.ID < 0 OR true RETURN a.gender;";
+    ASSERT_STREQ(getEncodedPlan(q2).c_str(), "S(a)");
+}
+
+TEST_F(OptimizerTest, CommonSubexpressionTest) {
+    auto q1 = "MATCH (a:person) WHERE a.age * 2 > 60 RETURN a.age * 2;";
+    auto op = getRoot(q1)->getLastOperator();
+    while (op->getOperatorType() != planner::LogicalOperatorType::FILTER) {
+        op = op->getChild(0);
+    }
+    // a.age * 2 is computed once below the filter.
+    ASSERT_EQ(op->getChild(0)->getOperatorType(), planner::LogicalOperatorType::PROJECTION);
+}
+
+TEST_F(OptimizerTest, LateMaterializationTest) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, x INT64, s STRING, PRIMARY KEY(id));")
+                    ->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(1, 1000) AS i CREATE (:T {id: i, x: i % 100, s: 'a'});")
+            ->isSuccess());
+    // Only t.x is scanned, and t.s is fetched for the nodes passing the filter.
+    auto op = getRoot("MATCH (t:T) WHERE t.x = 1 RETURN t.s;")->getLastOperator();
+    while (op->getOperatorType() != planner::LogicalOperatorType::FETCH_NODE_PROPERTY) {
+        ASSERT_EQ(op->getNumChildren(), 1u);
+        op = op->getChild(0);
+    }
+    ASSERT_EQ(op->getChild(0)->getOperatorType(), planner::LogicalOperatorType::FILTER);
+    auto& scan = op->getChild(0)->getChild(0)->constCast<planner::LogicalScanNodeTable>();
+    ASSERT_EQ(scan.getProperties().size(), 1u);
+    // The filter is not selective enough.
+    auto q2 = "MATCH (t:T) WHERE t.x > 1 RETURN t.s;";
+    op = getRoot(q2)->getLastOperator();
+    while (op->getNumChildren() > 0) {
+        ASSERT_NE(op->getOperatorType(), planner::LogicalOperatorType::FETCH_NODE_PROPERTY);
+        op = op->getChild(0);
+    }
+}
+
+static bool containsOperator(const planner::LogicalOperator& op,
+    planner::LogicalOperatorType type) {
+    if (op.getOperatorType() == type) {
+        return true;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (containsOperator(*op.getChild(i), type)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_F(OptimizerTest, ColumnStatisticsTest) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, x INT64, s STRING, PRIMARY KEY(id));")
+                    ->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(1, 1000) AS i CREATE (:T {id: i, x: i % 10, s: 'a'});")
+            ->isSuccess());
+    auto hasLateMaterialization = [&](const std::string& query) {
+        return containsOperator(*getRoot(query)->getLastOperator(),
+            planner::LogicalOperatorType::FETCH_NODE_PROPERTY);
+    };
+    auto q1 = "MATCH (t:T) WHERE t.x = 1 RETURN t.s;";
+    auto q2 = "MATCH (t:T) WHERE t.id < 10 RETURN t.s;";
+    // Without statistics, equality predicates are assumed to be selective and range predicates not.
+    ASSERT_TRUE(hasLateMaterialization(q1));
+    ASSERT_FALSE(hasLateMaterialization(q2));
+    ASSERT_TRUE(conn->query("CALL analyze('T') RETURN *;")->isSuccess());
+    // t.x = 1 selects 10% of the nodes, t.id < 10 less than 1%.
+    ASSERT_FALSE(hasLateMaterialization(q1));
+    ASSERT_TRUE(hasLateMaterialization(q2));
+    // Statistics are persisted with the catalog.
+    createDBAndConn();
+    ASSERT_FALSE(hasLateMaterialization(q1));
+    ASSERT_TRUE(hasLateMaterialization(q2));
+}
+
+TEST_F(OptimizerTest, CountRelTableTest) {
+    auto hasCountRelTable = [&](const std::string& query) {
+        return containsOperator(*getRoot(query)->getLastOperator(),
+            planner::LogicalOperatorType::COUNT_REL_TABLE);
+    };
+    ASSERT_TRUE(hasCountRelTable("MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, COUNT(b);"));
+    ASSERT_TRUE(hasCountRelTable("MATCH (a:person)<-[e:knows]-(:person) RETURN a, COUNT(e);"));
+    ASSERT_TRUE(
+        hasCountRelTable("MATCH (a:person) RETURN a.ID, COUNT { MATCH (a)-[:knows]->(:person) };"));
+    // Filtered rels or nbr nodes need a scan of adjacency lists.
+    ASSERT_FALSE(hasCountRelTable("MATCH (a:person)-[e:knows]->(b:person) "
+                                  "WHERE e.date > date('1999-01-01') RETURN a.ID, COUNT(*);"));
+    ASSERT_FALSE(hasCountRelTable(
+        "MATCH (a:person)-[:knows]->(b:person) WHERE b.age > 30 RETURN a.ID, COUNT(*);"));
+    // Keys that do not identify the bound node.
+    ASSERT_FALSE(
+        hasCountRelTable("MATCH (a:person)-[:knows]->(b:person) RETURN a.gender, COUNT(*);"));
+    ASSERT_FALSE(hasCountRelTable(
+        "MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, COUNT(DISTINCT b.gender);"));
+}
+
+TEST_F(OptimizerTest, LargeJoinOrderTest) {
+    // A 12-node chain exceeds the levels planned exactly, so the join order is enumerated over the
+    // retained subgraphs of lower levels.
+    std::string pattern = "(a0:person)";
+    for (auto i = 1u; i < 12; ++i) {
+        pattern += "-[:knows]->(a" + std::to_string(i) + ":person)";
+    }
+    auto query = "MATCH " + pattern + " RETURN COUNT(*);";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_GT(result->getQuerySummary()->getPlanningTime(), 0);
+    ASSERT_LE(result->getQuerySummary()->getPlanningTime(),
+        result->getQuerySummary()->getCompilingTime());
+    auto numWalks = result->getNext()->getValue(0)->getValue<int64_t>();
+    ASSERT_TRUE(conn->query("CALL recursive_pattern_semantic='WALK';")->isSuccess());
+    auto expected = conn->query("MATCH (a:person)-[:knows*11..11]->(b:person) RETURN COUNT(*);");
+    ASSERT_TRUE(expected->isSuccess()) << expected->getErrorMessage();
+    ASSERT_EQ(numWalks, expected->getNext()->getValue(0)->getValue<int64_t>());
+}
+
 } // namespace testing
 } // namespace kuzu
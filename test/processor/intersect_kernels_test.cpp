@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "processor/operator/intersect/intersect_kernels.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+static constexpr IntersectKernelType ALL_KERNELS[] = {IntersectKernelType::MERGE,
+    IntersectKernelType::GALLOPING, IntersectKernelType::DENSE};
+
+static std::vector<nodeID_t> generateList(std::mt19937& rng, uint64_t size, offset_t maxOffset) {
+    std::uniform_int_distribution<offset_t> dist(0, maxOffset);
+    std::vector<nodeID_t> result;
+    for (auto i = 0u; i < size; i++) {
+        result.emplace_back(dist(rng), 0 /* tableID */);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+struct IntersectResult {
+    std::vector<sel_t> leftPositions;
+    std::vector<sel_t> rightPositions;
+};
+
+static IntersectResult intersect(IntersectKernelType kernelType,
+    const std::vector<nodeID_t>& left, const std::vector<nodeID_t>& right) {
+    IntersectResult result;
+    result.leftPositions.resize(std::min(left.size(), right.size()));
+    result.rightPositions.resize(std::min(left.size(), right.size()));
+    auto numMatches = IntersectKernels::intersect(kernelType, left.data(), left.size(),
+        right.data(), right.size(), result.leftPositions.data(), result.rightPositions.data());
+    result.leftPositions.resize(numMatches);
+    result.rightPositions.resize(numMatches);
+    return result;
+}
+
+static void checkAllKernelsMatchMerge(const std::vector<nodeID_t>& left,
+    const std::vector<nodeID_t>& right) {
+    auto expected = intersect(IntersectKernelType::MERGE, left, right);
+    for (auto kernelType : ALL_KERNELS) {
+        if (kernelType == IntersectKernelType::DENSE && !right.empty() &&
+            right.back().offset - right.front().offset >= IntersectKernels::MAX_DENSE_RANGE) {
+            continue;
+        }
+        auto result = intersect(kernelType, left, right);
+        ASSERT_EQ(result.leftPositions, expected.leftPositions);
+        ASSERT_EQ(result.rightPositions, expected.rightPositions);
+    }
+}
+
+TEST(IntersectKernelsTest, EmptyLists) {
+    std::vector<nodeID_t> empty;
+    std::vector<nodeID_t> list = {{1, 0}, {2, 0}};
+    for (auto kernelType : ALL_KERNELS) {
+        ASSERT_TRUE(intersect(kernelType, empty, list).leftPositions.empty());
+        ASSERT_TRUE(intersect(kernelType, list, empty).leftPositions.empty());
+    }
+}
+
+TEST(IntersectKernelsTest, Duplicates) {
+    // The i-th occurrence of an offset on the left matches the i-th occurrence on the right.
+    std::vector<nodeID_t> left = {{1, 0}, {3, 0}, {3, 0}, {3, 0}, {5, 0}, {7, 0}};
+    std::vector<nodeID_t> right = {{0, 0}, {3, 0}, {3, 0}, {4, 0}, {5, 0}, {5, 0}, {7, 0},
+        {8, 0}};
+    for (auto kernelType : ALL_KERNELS) {
+        auto result = intersect(kernelType, left, right);
+        ASSERT_EQ(result.leftPositions, (std::vector<sel_t>{1, 2, 4, 5}));
+        ASSERT_EQ(result.rightPositions, (std::vector<sel_t>{1, 2, 4, 6}));
+    }
+}
+
+TEST(IntersectKernelsTest, RandomLists) {
+    std::mt19937 rng(0);
+    const uint64_t sizes[] = {1, 3, 4, 5, 17, 64, 500, 2048};
+    const offset_t maxOffsets[] = {10, 1000, 4000, 1000000};
+    for (auto leftSize : sizes) {
+        for (auto rightSize : sizes) {
+            for (auto maxOffset : maxOffsets) {
+                auto left = generateList(rng, leftSize, maxOffset);
+                auto right = generateList(rng, rightSize, maxOffset);
+                checkAllKernelsMatchMerge(left, right);
+            }
+        }
+    }
+}
+
+TEST(IntersectKernelsTest, ChooseKernel) {
+    std::mt19937 rng(0);
+    // A small list against the list of a hub node.
+    auto small = generateList(rng, 8, 1000000);
+    auto hub = generateList(rng, 2048, 1000000);
+    ASSERT_EQ(IntersectKernels::chooseKernel(small.data(), small.size(), hub.data(), hub.size()),
+        IntersectKernelType::GALLOPING);
+    // Lists of similar sizes over a sparse range.
+    auto sparse = generateList(rng, 1024, 1000000);
+    ASSERT_EQ(IntersectKernels::chooseKernel(sparse.data(), sparse.size(), hub.data(), hub.size()),
+        IntersectKernelType::MERGE);
+    // Lists of similar sizes over a dense range.
+    auto dense1 = generateList(rng, 1024, 2000);
+    auto dense2 = generateList(rng, 1500, 2000);
+    ASSERT_EQ(
+        IntersectKernels::chooseKernel(dense1.data(), dense1.size(), dense2.data(), dense2.size()),
+        IntersectKernelType::DENSE);
+}
+
+// Microbenchmark of the kernels for the list shapes used to tune IntersectKernels::chooseKernel.
+// Run with --gtest_also_run_disabled_tests.
+TEST(IntersectKernelsTest, DISABLED_Microbenchmark) {
+    struct Shape {
+        const char* name;
+        uint64_t leftSize;
+        uint64_t rightSize;
+        offset_t maxOffset;
+    };
+    const Shape shapes[] = {{"skewed", 16, 2048, 1000000}, {"ratio-8", 256, 2048, 1000000},
+        {"ratio-4", 512, 2048, 1000000}, {"similar-sparse", 1024, 2048, 1000000},
+        {"similar-dense", 1024, 2048, 3000}, {"small", 8, 16, 100}};
+    static constexpr uint64_t NUM_REPETITIONS = 10000;
+    std::mt19937 rng(0);
+    std::vector<sel_t> leftPositions(2048), rightPositions(2048);
+    for (auto& shape : shapes) {
+        auto left = generateList(rng, shape.leftSize, shape.maxOffset);
+        auto right = generateList(rng, shape.rightSize, shape.maxOffset);
+        for (auto kernelType : ALL_KERNELS) {
+            if (kernelType == IntersectKernelType::DENSE &&
+                right.back().offset - right.front().offset >= IntersectKernels::MAX_DENSE_RANGE) {
+                continue;
+            }
+            uint64_t numMatches = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (auto i = 0u; i < NUM_REPETITIONS; i++) {
+                numMatches += IntersectKernels::intersect(kernelType, left.data(), left.size(),
+                    right.data(), right.size(), leftPositions.data(), rightPositions.data());
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start)
+                               .count();
+            std::cout << shape.name << " kernel " << (int)kernelType << ": "
+                      << elapsed / NUM_REPETITIONS << " ns (" << numMatches << " matches)"
+                      << std::endl;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#include <span>
+#include <string>
+#include <vector>
+
+#include "catalog/catalog.h"
+#include "common/vector/value_vector.h"
+#include "graph_test/graph_test.h"
+#include "main/client_context.h"
+#include "storage/index/hash_index.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace testing {
+
+class PrimaryKeyIndexTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CALL auto_checkpoint=false")->isSuccess());
+    }
+
+    void TearDown() override { EmptyDBTest::TearDown(); }
+
+    void query(const std::string& statement) {
+        auto result = conn->query(statement);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+
+    NodeTable& getNodeTable(const std::string& tableName) {
+        auto context = getClientContext(*conn);
+        auto tableID = context->getCatalog()->getTableID(context->getTx(), tableName);
+        return getStorageManager(*database)->getTable(tableID)->cast<NodeTable>();
+    }
+
+    // Checks the batched lookup of the keys against one lookup per key, and returns its results.
+    std::vector<offset_t> lookup(const std::string& tableName, ValueVector& keyVector,
+        uint64_t numKeys) {
+        auto transaction = getClientContext(*conn)->getTx();
+        auto& nodeTable = getNodeTable(tableName);
+        std::vector<sel_t> positions(numKeys);
+        for (auto i = 0u; i < numKeys; i++) {
+            positions[i] = i;
+        }
+        std::vector<offset_t> results(numKeys);
+        nodeTable.lookupPKs(transaction, &keyVector, positions, results);
+        for (auto i = 0u; i < numKeys; i++) {
+            offset_t result = INVALID_OFFSET;
+            if (!nodeTable.lookupPK(transaction, &keyVector, i, result)) {
+                result = INVALID_OFFSET;
+            }
+            EXPECT_EQ(results[i], result) << "key at position " << i;
+        }
+        return results;
+    }
+};
+
+// The table is built in stages, so that keys are looked up in the persistent index, in the local
+// storage of the index (committed but not checkpointed) and in the local table of the transaction.
+TEST_F(PrimaryKeyIndexTest, BatchedInt64Lookup) {
+    query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id))");
+    query("COPY T FROM (UNWIND range(0, 29999) AS i RETURN i * 3)");
+    query("CHECKPOINT");
+    query("UNWIND range(0, 99) AS i CREATE (:T {id: 100000 + i})");
+    query("BEGIN TRANSACTION");
+    query("MATCH (t:T) WHERE t.id % 10 = 0 DELETE t");
+    query("UNWIND range(0, 9) AS i CREATE (:T {id: 200000 + i})");
+
+    // Checkpointed, duplicated, missing, deleted, committed and uncommitted keys.
+    const std::vector<int64_t> keys{3, 89997, 3, 1, 30, 100001, 100010, 100001, 200003, 200010,
+        6, -3};
+    ValueVector keyVector{LogicalType::INT64(), getMemoryManager(*database)};
+    keyVector.state = DataChunkState::getSingleValueDataChunkState();
+    for (auto i = 0u; i < keys.size(); i++) {
+        keyVector.setValue<int64_t>(i, keys[i]);
+    }
+    auto results = lookup("T", keyVector, keys.size());
+    EXPECT_EQ(results[0], 1);
+    EXPECT_EQ(results[1], 29999);
+    EXPECT_EQ(results[2], 1);
+    EXPECT_EQ(results[3], INVALID_OFFSET);
+    EXPECT_EQ(results[4], INVALID_OFFSET);
+    EXPECT_EQ(results[5], 30001);
+    EXPECT_EQ(results[6], INVALID_OFFSET);
+    EXPECT_EQ(results[7], 30001);
+    EXPECT_NE(results[8], INVALID_OFFSET);
+    EXPECT_EQ(results[9], INVALID_OFFSET);
+    EXPECT_EQ(results[10], 2);
+    EXPECT_EQ(results[11], INVALID_OFFSET);
+
+    // Results which are not INVALID_OFFSET on entry are already resolved and left untouched.
+    auto transaction = getClientContext(*conn)->getTx();
+    auto& nodeTable = getNodeTable("T");
+    std::vector<sel_t> positions{0, 1, 3};
+    std::vector<offset_t> resolved{INVALID_OFFSET, 12345, INVALID_OFFSET};
+    nodeTable.getPKIndex()->lookup(transaction, &keyVector, positions, resolved,
+        [&](offset_t offset) { return nodeTable.isVisible(transaction, offset); });
+    EXPECT_EQ(resolved[0], 1);
+    EXPECT_EQ(resolved[1], 12345);
+    EXPECT_EQ(resolved[2], INVALID_OFFSET);
+    query("COMMIT");
+}
+
+TEST_F(PrimaryKeyIndexTest, BatchedOverflowStringLookup) {
+    const std::string prefix = "a key longer than the inline prefix of a string ";
+    query("CREATE NODE TABLE T(id STRING, PRIMARY KEY(id))");
+    query("COPY T FROM (UNWIND range(0, 9999) AS i RETURN concat('" + prefix + "', string(i)))");
+    query("CHECKPOINT");
+    query("CREATE (:T {id: '" + prefix + "committed'})");
+    query("BEGIN TRANSACTION");
+    query("MATCH (t:T) WHERE t.id = '" + prefix + "7' DELETE t");
+    query("CREATE (:T {id: '" + prefix + "uncommitted'})");
+
+    const std::vector<std::string> keys{prefix + "0", prefix + "9999", prefix + "0", prefix + "7",
+        prefix + "10000", prefix + "committed", prefix + "uncommitted", "short"};
+    ValueVector keyVector{LogicalType::STRING(), getMemoryManager(*database)};
+    keyVector.state = DataChunkState::getSingleValueDataChunkState();
+    for (auto i = 0u; i < keys.size(); i++) {
+        StringVector::addString(&keyVector, i, keys[i]);
+    }
+    auto results = lookup("T", keyVector, keys.size());
+    EXPECT_EQ(results[0], 0);
+    EXPECT_EQ(results[1], 9999);
+    EXPECT_EQ(results[2], 0);
+    EXPECT_EQ(results[3], INVALID_OFFSET);
+    EXPECT_EQ(results[4], INVALID_OFFSET);
+    EXPECT_EQ(results[5], 10000);
+    EXPECT_NE(results[6], INVALID_OFFSET);
+    EXPECT_EQ(results[7], INVALID_OFFSET);
+    query("COMMIT");
+}
+
+} // namespace testing
+} // namespace kuzu
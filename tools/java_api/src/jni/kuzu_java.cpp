@@ -379,6 +379,12 @@ JNIEXPORT void JNICALL Java_com_kuzudb_Native_kuzu_1connection_1set_1query_1time
     conn->setQueryTimeOut(timeout);
 }
 
+JNIEXPORT void JNICALL Java_com_kuzudb_Native_kuzu_1connection_1set_1stream_1results(JNIEnv* env,
+    jclass, jobject thisConn, jboolean stream_results) {
+    Connection* conn = getConnection(env, thisConn);
+    conn->setStreamResults(static_cast<bool>(stream_results));
+}
+
 /**
  * All PreparedStatement native functions
  */
@@ -487,7 +493,13 @@ JNIEXPORT jobject JNICALL Java_com_kuzudb_Native_kuzu_1query_1result_1get_1query
 JNIEXPORT jboolean JNICALL Java_com_kuzudb_Native_kuzu_1query_1result_1has_1next(JNIEnv* env,
     jclass, jobject thisQR) {
     QueryResult* qr = getQueryResult(env, thisQR);
-    return static_cast<jboolean>(qr->hasNext());
+    // Streamed results may fail while they are being iterated.
+    try {
+        return static_cast<jboolean>(qr->hasNext());
+    } catch (Exception& e) {
+        env->ThrowNew(J_C_Exception, e.what());
+    }
+    return static_cast<jboolean>(false);
 }
 
 JNIEXPORT jobject JNICALL Java_com_kuzudb_Native_kuzu_1query_1result_1get_1next(JNIEnv* env, jclass,
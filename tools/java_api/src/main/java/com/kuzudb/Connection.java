@@ -122,4 +122,16 @@ public class Connection {
         checkNotDestroyed();
         Native.kuzu_connection_set_query_timeout(this, timeoutInMs);
     }
+
+    /**
+    * Sets whether the results of read-only queries are streamed while the query executes instead of being
+    * materialized first. A streamed result keeps its transaction open until it is fully consumed or closed.
+    * Executing another query on the same connection buffers the rest of the result first.
+    * @param streamResults: Whether to stream query results.
+    * @throws ObjectRefDestroyedException If the connection has been destroyed.
+    */
+    public void setStreamResults(boolean streamResults) throws ObjectRefDestroyedException {
+        checkNotDestroyed();
+        Native.kuzu_connection_set_stream_results(this, streamResults);
+    }
 }
@@ -99,6 +99,9 @@ public class Native {
     protected static native void kuzu_connection_set_query_timeout(
             Connection connection, long timeout_in_ms);
 
+    protected static native void kuzu_connection_set_stream_results(
+            Connection connection, boolean stream_results);
+
     // PreparedStatement
     protected static native void kuzu_prepared_statement_destroy(PreparedStatement prepared_statement);
 
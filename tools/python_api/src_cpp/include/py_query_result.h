@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "arrow_array.h"
@@ -10,6 +11,13 @@
 
 using namespace kuzu::main;
 
+// Shared between a query result and the Arrow C streams exported from it, so that the streams
+// stop reading once the query result is closed.
+struct PyArrowStreamState {
+    std::mutex mtx;
+    bool closed = false;
+};
+
 class PyQueryResult {
     friend class PyConnection;
 
@@ -36,6 +44,8 @@ public:
 
     kuzu::pyarrow::Table getAsArrow(std::int64_t chunkSize);
 
+    py::object getArrowCStream(std::int64_t chunkSize);
+
     py::list getColumnDataTypes();
 
     py::list getColumnNames();
@@ -63,4 +73,5 @@ private:
 private:
     QueryResult* queryResult = nullptr;
     bool isOwned = false;
+    std::shared_ptr<PyArrowStreamState> arrowStreamState;
 };
@@ -1,5 +1,6 @@
 #include "include/py_query_result.h"
 
+#include <cerrno>
 #include <string>
 
 #include "cached_import/py_cached_import.h"
@@ -28,6 +29,7 @@ void PyQueryResult::initialize(py::handle& m) {
         .def("close", &PyQueryResult::close)
         .def("getAsDF", &PyQueryResult::getAsDF)
         .def("getAsArrow", &PyQueryResult::getAsArrow)
+        .def("getArrowCStream", &PyQueryResult::getArrowCStream)
         .def("getColumnNames", &PyQueryResult::getColumnNames)
         .def("getColumnDataTypes", &PyQueryResult::getColumnDataTypes)
         .def("resetIterator", &PyQueryResult::resetIterator)
@@ -77,6 +79,12 @@ void PyQueryResult::close() {
     // Note: Python does not guarantee objects to be deleted in the reverse order. Therefore, we
     // expose close() interface so that users can explicitly call close() and ensure that
     // QueryResult is destroyed before Database.
+    std::unique_lock<std::mutex> lck;
+    if (arrowStreamState != nullptr) {
+        // Wait for any exported stream to finish its current read.
+        lck = std::unique_lock{arrowStreamState->mtx};
+        arrowStreamState->closed = true;
+    }
     if (isOwned) {
         delete queryResult;
         queryResult = nullptr;
@@ -388,6 +396,88 @@ kuzu::pyarrow::Table PyQueryResult::getAsArrow(std::int64_t chunkSize) {
     return py::cast<kuzu::pyarrow::Table>(fromBatchesFunc(batches, schemaObj));
 }
 
+static void releaseArrowArrayStreamCapsule(PyObject* capsule) {
+    auto stream =
+        static_cast<ArrowArrayStream*>(PyCapsule_GetPointer(capsule, "arrow_array_stream"));
+    if (stream->release != nullptr) {
+        stream->release(stream);
+    }
+    delete stream;
+}
+
+// Wraps the stream of the query result, and fails reads once the query result is closed.
+struct PyArrowArrayStreamHolder {
+    ArrowArrayStream stream;
+    std::shared_ptr<PyArrowStreamState> state;
+    std::string lastError;
+};
+
+static int getClosedStreamError(PyArrowArrayStreamHolder* holder) {
+    holder->lastError = "Query result is closed.";
+    return EINVAL;
+}
+
+static int getPyArrowArrayStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+    auto holder = static_cast<PyArrowArrayStreamHolder*>(stream->private_data);
+    std::unique_lock lck{holder->state->mtx};
+    if (holder->state->closed) {
+        return getClosedStreamError(holder);
+    }
+    return holder->stream.get_schema(&holder->stream, out);
+}
+
+static int getPyArrowArrayStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+    auto holder = static_cast<PyArrowArrayStreamHolder*>(stream->private_data);
+    std::unique_lock lck{holder->state->mtx};
+    if (holder->state->closed) {
+        return getClosedStreamError(holder);
+    }
+    return holder->stream.get_next(&holder->stream, out);
+}
+
+static const char* getPyArrowArrayStreamLastError(ArrowArrayStream* stream) {
+    auto holder = static_cast<PyArrowArrayStreamHolder*>(stream->private_data);
+    if (!holder->lastError.empty()) {
+        return holder->lastError.c_str();
+    }
+    return holder->stream.get_last_error(&holder->stream);
+}
+
+static void releasePyArrowArrayStream(ArrowArrayStream* stream) {
+    if (!stream || !stream->release) {
+        return;
+    }
+    stream->release = nullptr;
+    auto holder = static_cast<PyArrowArrayStreamHolder*>(stream->private_data);
+    // Releasing the inner stream only frees its own state, not the query result.
+    holder->stream.release(&holder->stream);
+    delete holder;
+}
+
+py::object PyQueryResult::getArrowCStream(std::int64_t chunkSize) {
+    // See https://arrow.apache.org/docs/format/CDataInterface/PyCapsuleInterface.html
+    if (arrowStreamState == nullptr) {
+        arrowStreamState = std::make_shared<PyArrowStreamState>();
+    }
+    auto holder = std::make_unique<PyArrowArrayStreamHolder>();
+    holder->stream = *queryResult->getArrowArrayStream(chunkSize);
+    holder->state = arrowStreamState;
+    auto stream = std::make_unique<ArrowArrayStream>();
+    stream->get_schema = getPyArrowArrayStreamSchema;
+    stream->get_next = getPyArrowArrayStreamNext;
+    stream->get_last_error = getPyArrowArrayStreamLastError;
+    stream->release = releasePyArrowArrayStream;
+    stream->private_data = holder.release();
+    auto capsule =
+        PyCapsule_New(stream.get(), "arrow_array_stream", releaseArrowArrayStreamCapsule);
+    if (capsule == nullptr) {
+        releasePyArrowArrayStream(stream.get());
+        throw py::error_already_set();
+    }
+    stream.release();
+    return py::reinterpret_steal<py::object>(capsule);
+}
+
 py::list PyQueryResult::getColumnDataTypes() {
     auto columnDataTypes = queryResult->getColumnDataTypes();
     py::tuple result(columnDataTypes.size());
@@ -229,6 +229,22 @@ class Connection:
         self.init_connection()
         self._connection.set_query_timeout(timeout_in_ms)
 
+    def set_stream_results(self, stream_results: bool) -> None:
+        """
+        Set whether the results of read-only queries are streamed while the query executes
+        instead of being materialized first. A streamed result keeps its transaction open until
+        it is fully consumed or closed. Executing another query on the same connection buffers
+        the rest of the result first.
+
+        Parameters
+        ----------
+        stream_results : bool
+            whether to stream query results.
+
+        """
+        self.init_connection()
+        self._connection.set_stream_results(stream_results)
+
     def create_function(
         self,
         name: str,
@@ -173,16 +173,40 @@ class QueryResult:
         """
         self.check_for_query_result_close()
 
+        return self._query_result.getAsArrow(self._get_arrow_chunk_size(chunk_size))
+
+    def __arrow_c_stream__(self, requested_schema: object | None = None) -> object:
+        """
+        Export the remaining tuples of the query result as an Arrow C stream.
+
+        This implements the Arrow PyCapsule interface, so the query result can be passed directly
+        to consumers such as `pyarrow.table` or `polars.from_arrow`. The stream must be consumed
+        before the query result is closed; reading from it afterwards raises an error.
+
+        Parameters
+        ----------
+        requested_schema : object | None
+            Ignored; the stream always uses the schema of the query result.
+
+        Returns
+        -------
+        PyCapsule
+            A capsule named "arrow_array_stream" holding the stream.
+        """
+        self.check_for_query_result_close()
+
+        return self._query_result.getArrowCStream(self._get_arrow_chunk_size(None))
+
+    def _get_arrow_chunk_size(self, chunk_size: int | None) -> int:
         if chunk_size is None:
             # Adaptive; target 10m total elements in each chunk.
             # (eg: if we had 10 cols, this would result in a 1m row chunk_size).
             target_n_elems = 10_000_000
-            chunk_size = max(target_n_elems // len(self.get_column_names()), 10)
-        elif chunk_size <= 0:
+            return max(target_n_elems // len(self.get_column_names()), 10)
+        if chunk_size <= 0:
             # No chunking: return the entire result as a single chunk
-            chunk_size = self.get_num_tuples()
-
-        return self._query_result.getAsArrow(chunk_size)
+            return self.get_num_tuples()
+        return chunk_size
 
     def get_column_data_types(self) -> list[str]:
         """
@@ -9,6 +9,7 @@ import ground_truth
 import kuzu
 import polars as pl
 import pyarrow as pa
+import pytest
 import pytz
 from pandas import Timestamp
 from type_aliases import ConnDB
@@ -480,6 +481,26 @@ def test_to_arrow_map(conn_db_readonly: ConnDB) -> None:
     ]
 
 
+def test_arrow_c_stream(conn_db_readonly: ConnDB) -> None:
+    conn = conn_db_readonly[0]
+    result = conn.execute("MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID")
+    reader = pa.RecordBatchReader._import_from_c_capsule(result.__arrow_c_stream__())
+    arrow_tbl = reader.read_all()
+    assert arrow_tbl.column_names == ["a.ID", "a.fName"]
+    assert arrow_tbl["a.ID"].to_pylist() == [0, 2, 3, 5, 7, 8, 9, 10]
+    assert arrow_tbl["a.fName"].to_pylist()[:3] == ["Alice", "Bob", "Carol"]
+    result.close()
+
+
+def test_arrow_c_stream_after_close(conn_db_readonly: ConnDB) -> None:
+    conn = conn_db_readonly[0]
+    result = conn.execute("MATCH (a:person) RETURN a.ID")
+    reader = pa.RecordBatchReader._import_from_c_capsule(result.__arrow_c_stream__())
+    result.close()
+    with pytest.raises(pa.ArrowInvalid, match="Query result is closed."):
+        reader.read_all()
+
+
 def test_to_arrow_complex(conn_db_readonly: ConnDB) -> None:
     conn, db = conn_db_readonly
 